@@ -329,6 +329,12 @@ struct SettingsAdvanced {
     std::array<float, 5> fAnimSpeedFormula = { 0.142f, 0.82f, 1.90f, 1.0f, 0.0f };
     bool bGTSAnimsFullSpeed = false;
     float fAnimspeedLowestBoundAllowed = 0.01f;
+
+    // PapyrusUpdate passes per second (0 = whenever the VM sends OnUpdate)
+    float fPapyrusUpdateRate = 10.0f;
+
+    // Hex seed for random rolls, empty picks a new one every load (see the "rngseed" console command)
+    std::string sRandomSeed = "";
 };
 TOML_SERIALIZABLE(SettingsAdvanced);
 
@@ -0,0 +1,356 @@
+#include "Data/Compactor.hpp"
+#include "Managers/Console/ConsoleManager.hpp"
+
+namespace {
+
+	// Seconds of world time between passes
+	constexpr double PassInterval = 60.0;
+	// Time a background pass may spend per frame
+	constexpr double StepBudgetMs = 0.2;
+
+	// Unloaded non follower actors that kept a changed size are forgotten after this many in-game days
+	constexpr float ActorDataUnseenDays = 30.0f;
+	// Transient data of unloaded non follower actors is dropped after this many seconds
+	constexpr double TransientUnseenSeconds = 300.0;
+
+	constexpr FormID PlayerFormID = 0x14;
+
+	template <class Map>
+	std::size_t MapBytes(const Map& a_map) {
+		// Every node holds the value plus its list links, MSVC keeps a pair of iterators per bucket
+		return a_map.size() * (sizeof(typename Map::value_type) + 2 * sizeof(void*)) + a_map.bucket_count() * 2 * sizeof(void*);
+	}
+
+	bool NearlyEqual(float a_value, float a_expected) {
+		return std::fabs(a_value - a_expected) < 1e-4f;
+	}
+
+	// True if nothing in the entry would be lost by recreating it with defaults when the actor loads again.
+	// max_scale, half_life, anim_speed and smt_run_speed are recomputed every frame for loaded actors so they are ignored.
+	bool IsDefaultActorData(const GTS::ActorData& a_data) {
+		return NearlyEqual(a_data.visual_scale, 1.0f) && NearlyEqual(a_data.target_scale, 1.0f) &&
+			NearlyEqual(a_data.visual_scale_v, 0.0f) && NearlyEqual(a_data.target_scale_v, 0.0f) &&
+			NearlyEqual(a_data.NormalDamage, 1.0f) && NearlyEqual(a_data.SprintDamage, 1.0f) &&
+			NearlyEqual(a_data.FallDamage, 1.0f) && NearlyEqual(a_data.HHDamage, 1.0f) &&
+			a_data.SizeReserve == 0.0f && a_data.stolen_attributes == 0.0f && a_data.stolen_health == 0.0f &&
+			a_data.stolen_magick == 0.0f && a_data.stolen_stamin == 0.0f &&
+			!a_data.ShowSizebarInUI && a_data.MoanSoundDescriptorIndex == 0;
+	}
+
+	bool IsEmptyKillCountData(const GTS::KillCountData& a_data) {
+		static const GTS::KillCountData Empty = {};
+		return std::memcmp(&a_data, &Empty, sizeof(GTS::KillCountData)) == 0;
+	}
+
+	// LookupByID is also null for ordinary actors whose cell isn't loaded, so only a form whose plugin
+	// is no longer in the load order counts as gone
+	bool IsFormGone(FormID a_id, const Actor* a_actor) {
+		if (a_actor) {
+			return false;
+		}
+		auto handler = RE::TESDataHandler::GetSingleton();
+		if (!handler) {
+			return false;
+		}
+		const std::uint8_t modIndex = a_id >> 24;
+		switch (modIndex) {
+			case 0xFF: {
+				// Runtime forms have no plugin, age them out like any other unloaded actor
+				return false;
+			}
+			case 0xFE: {
+				return handler->LookupLoadedLightModByIndex(static_cast<std::uint16_t>((a_id >> 12) & 0xFFF)) == nullptr;
+			}
+			default: {
+				return handler->LookupLoadedModByIndex(modIndex) == nullptr;
+			}
+		}
+	}
+
+	float GetDaysPassed() {
+		auto calendar = RE::Calendar::GetSingleton();
+		return calendar ? calendar->GetDaysPassed() : 0.0f;
+	}
+
+	std::string FormatFootprint(const GTS::DataFootprint& a_footprint) {
+		return std::format("{} actor, {} kill count, {} transient entries, ~{:.1f} KiB in memory, {:.1f} KiB in the cosave",
+			a_footprint.ActorEntries, a_footprint.KillCountEntries, a_footprint.TransientEntries,
+			static_cast<double>(a_footprint.MemoryBytes) / 1024.0, static_cast<double>(a_footprint.CosaveBytes) / 1024.0);
+	}
+
+	void CMD_CompactData() {
+		GTS::DataCompactor::CompactNow();
+	}
+}
+
+namespace GTS {
+
+	DataCompactor& DataCompactor::GetSingleton() noexcept {
+		static DataCompactor instance;
+		return instance;
+	}
+
+	std::string DataCompactor::DebugName() {
+		return "::DataCompactor";
+	}
+
+	void DataCompactor::DataReady() {
+		ConsoleManager::RegisterCommand("compactdata", CMD_CompactData, "Evict stale actor data now and report its size before and after");
+	}
+
+	void DataCompactor::Update() {
+		static Timer PassTimer = Timer(PassInterval);
+		if (!this->active) {
+			if (!PassTimer.ShouldRun()) {
+				return;
+			}
+			this->BeginPass();
+		}
+
+		GTS_PROFILE_SCOPE("DataCompactor: Step");
+		if (this->Step(StepBudgetMs)) {
+			this->EndPass();
+		}
+	}
+
+	void DataCompactor::Reset() {
+		// Keys collected before a load or a new game no longer mean anything
+		this->pending.clear();
+		this->cursor = 0;
+		this->active = false;
+		this->transientSeen.clear();
+	}
+
+	DataFootprint DataCompactor::GetFootprint() {
+		DataFootprint result = {};
+
+		std::size_t evictedActors = 0;
+		std::size_t evictedKillCounts = 0;
+		auto& persistent = Persistent::GetSingleton();
+		{
+			std::unique_lock lock(persistent._Lock);
+			result.ActorEntries = persistent.ActorDataMap.size();
+			result.KillCountEntries = persistent.KillCountDataMap.size();
+			result.MemoryBytes += MapBytes(persistent.ActorDataMap) + MapBytes(persistent.KillCountDataMap);
+			evictedActors = std::min(persistent.EvictedActorData.size(), result.ActorEntries);
+			evictedKillCounts = std::min(persistent.EvictedKillCountData.size(), result.KillCountEntries);
+		}
+
+		auto& transient = Transient::GetSingleton();
+		{
+			std::unique_lock lock(transient._Lock);
+			result.TransientEntries = transient.TempActorDataMap.size();
+			result.MemoryBytes += MapBytes(transient.TempActorDataMap);
+		}
+
+		// Same layout as WriteActorData / WriteKillCountData, which leave evicted entries out
+		result.CosaveBytes =
+			sizeof(std::size_t) + (result.ActorEntries - evictedActors) * (sizeof(FormID) + sizeof(ActorData)) +
+			sizeof(std::size_t) + sizeof(std::uint32_t) + (result.KillCountEntries - evictedKillCounts) * (sizeof(FormID) + sizeof(KillCountData));
+
+		return result;
+	}
+
+	void DataCompactor::CompactNow() {
+		auto& me = GetSingleton();
+		me.BeginPass();
+		const DataFootprint before = me.before;
+		const std::size_t pendingCount = me.pending.size();
+		me.Step(0.0);
+		const std::size_t evicted = me.evicted;
+		me.EndPass();
+
+		Cprint("--- Data Compaction ({} entries checked, {} evicted) ---", pendingCount, evicted);
+		Cprint("Before: {}", FormatFootprint(before));
+		Cprint("After: {}", FormatFootprint(GetFootprint()));
+	}
+
+	void DataCompactor::BeginPass() {
+		this->before = GetFootprint();
+		this->evicted = 0;
+		this->cursor = 0;
+		this->pending.clear();
+		this->daysPassed = GetDaysPassed();
+		this->worldTime = Time::WorldTimeElapsed();
+
+		this->loaded.clear();
+		this->loaded.insert(PlayerFormID);
+		for (const Actor* actor : find_actors()) {
+			if (actor) {
+				this->loaded.insert(actor->formID);
+			}
+		}
+
+		auto& persistent = Persistent::GetSingleton();
+		{
+			std::unique_lock lock(persistent._Lock);
+			this->pending.reserve(persistent.ActorDataMap.size() + persistent.KillCountDataMap.size());
+			for (auto& [id, data] : persistent.ActorDataMap) {
+				if (this->loaded.contains(id)) {
+					// Came back after it was evicted, save it again
+					persistent.EvictedActorData.erase(id);
+					data.last_seen = this->daysPassed;
+					continue;
+				}
+				if (!persistent.EvictedActorData.contains(id)) {
+					this->pending.push_back({ id, EntryKind::Actor });
+				}
+			}
+			for (const auto id : persistent.KillCountDataMap | views::keys) {
+				if (this->loaded.contains(id)) {
+					persistent.EvictedKillCountData.erase(id);
+					continue;
+				}
+				if (!persistent.EvictedKillCountData.contains(id)) {
+					this->pending.push_back({ id, EntryKind::KillCount });
+				}
+			}
+		}
+
+		auto& transient = Transient::GetSingleton();
+		{
+			std::unique_lock lock(transient._Lock);
+			for (const auto id : transient.TempActorDataMap | views::keys) {
+				if (this->loaded.contains(id)) {
+					this->transientSeen.insert_or_assign(id, this->worldTime);
+					continue;
+				}
+				// First time we see this entry unloaded, start its grace period now
+				this->transientSeen.try_emplace(id, this->worldTime);
+				this->pending.push_back({ id, EntryKind::Transient });
+			}
+		}
+
+		this->active = true;
+	}
+
+	bool DataCompactor::Step(double a_budgetMs) {
+		using Clock = std::chrono::steady_clock;
+		const auto start = Clock::now();
+
+		auto& persistent = Persistent::GetSingleton();
+		auto& transient = Transient::GetSingleton();
+
+		while (this->cursor < this->pending.size()) {
+			if (a_budgetMs > 0.0 && std::chrono::duration<double, std::milli>(Clock::now() - start).count() >= a_budgetMs) {
+				return false;
+			}
+
+			const PendingEntry entry = this->pending[this->cursor++];
+			Actor* actor = TESForm::LookupByID<Actor>(entry.id);
+
+			// Copy the entry out so the policy runs without holding the data lock
+			switch (entry.kind) {
+				case EntryKind::Actor: {
+					ActorData data;
+					{
+						std::unique_lock lock(persistent._Lock);
+						auto it = persistent.ActorDataMap.find(entry.id);
+						if (it == persistent.ActorDataMap.end()) {
+							break;
+						}
+						// Loaded from a save that predates last seen tracking, start counting from now
+						if (it->second.last_seen <= 0.0f) {
+							it->second.last_seen = this->daysPassed;
+						}
+						data = it->second;
+					}
+					if (this->ShouldEvictActorData(entry.id, actor, data)) {
+						std::unique_lock lock(persistent._Lock);
+						this->evicted += persistent.EvictedActorData.insert(entry.id).second;
+					}
+					break;
+				}
+				case EntryKind::KillCount: {
+					KillCountData data;
+					{
+						std::unique_lock lock(persistent._Lock);
+						auto it = persistent.KillCountDataMap.find(entry.id);
+						if (it == persistent.KillCountDataMap.end()) {
+							break;
+						}
+						data = it->second;
+					}
+					if (this->ShouldEvictKillCountData(entry.id, actor, data)) {
+						std::unique_lock lock(persistent._Lock);
+						this->evicted += persistent.EvictedKillCountData.insert(entry.id).second;
+					}
+					break;
+				}
+				case EntryKind::Transient: {
+					if (this->ShouldEvictTransientData(entry.id, actor)) {
+						std::unique_lock lock(transient._Lock);
+						this->evicted += transient.TempActorDataMap.erase(entry.id);
+					}
+					break;
+				}
+			}
+		}
+		return true;
+	}
+
+	void DataCompactor::EndPass() {
+		this->active = false;
+		this->pending.clear();
+
+		auto& transient = Transient::GetSingleton();
+		{
+			std::unique_lock lock(transient._Lock);
+			std::erase_if(this->transientSeen, [&transient](const auto& seen) {
+				return !transient.TempActorDataMap.contains(seen.first);
+			});
+			if (this->evicted > 0) {
+				// Rehashing only rebuilds the bucket array, pointers to the remaining entries stay valid
+				transient.TempActorDataMap.rehash(0);
+			}
+		}
+
+		if (this->evicted == 0) {
+			return;
+		}
+
+		log::info("DataCompactor: Evicted {} entries", this->evicted);
+		log::info("DataCompactor: Before {}", FormatFootprint(this->before));
+		log::info("DataCompactor: After {}", FormatFootprint(GetFootprint()));
+	}
+
+	bool DataCompactor::ShouldEvictActorData(FormID id, Actor* actor, const ActorData& data) const {
+		if (this->loaded.contains(id)) {
+			return false;
+		}
+		// Form no longer exists (e.g. a disabled mod's actor)
+		if (IsFormGone(id, actor)) {
+			return true;
+		}
+		// Recreated with the same values next time the actor loads
+		if (IsDefaultActorData(data)) {
+			return true;
+		}
+		if (actor && IsTeammate(actor)) {
+			return false;
+		}
+		return this->daysPassed - data.last_seen > ActorDataUnseenDays;
+	}
+
+	bool DataCompactor::ShouldEvictKillCountData(FormID id, Actor* actor, const KillCountData& data) const {
+		if (this->loaded.contains(id)) {
+			return false;
+		}
+		// Kill statistics are shown to the player, only drop them when there is nothing to show
+		return IsFormGone(id, actor) || IsEmptyKillCountData(data);
+	}
+
+	bool DataCompactor::ShouldEvictTransientData(FormID id, Actor* actor) const {
+		if (this->loaded.contains(id)) {
+			return false;
+		}
+		if (IsFormGone(id, actor)) {
+			return true;
+		}
+		if (actor && IsTeammate(actor)) {
+			return false;
+		}
+		auto it = this->transientSeen.find(id);
+		return it != this->transientSeen.end() && this->worldTime - it->second > TransientUnseenSeconds;
+	}
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include "Data/Persistent.hpp"
+
+// Incremental garbage collection for per actor data
+//
+// Persistent and Transient keep an entry for every actor the mod ever touched, which on long playthroughs
+// grows into thousands of entries that bloat the cosave, load time and the hash maps.
+// Every PassInterval seconds a pass snapshots the keys and walks them a slice per frame under a small time budget,
+// evicting entries by policy. Persistent entries are only marked, they stay in memory until the save leaves them out,
+// since other code holds pointers into those maps across frames. Transient storage is rehashed down once a pass
+// that evicted something completes.
+
+namespace GTS {
+
+	struct DataFootprint {
+		std::size_t ActorEntries = 0;
+		std::size_t KillCountEntries = 0;
+		std::size_t TransientEntries = 0;
+		std::size_t MemoryBytes = 0; // Approximate, nodes + buckets
+		std::size_t CosaveBytes = 0; // ActorData + KillCountData records
+	};
+
+	class DataCompactor : public EventListener {
+		public:
+			[[nodiscard]] static DataCompactor& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void DataReady() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+
+			static DataFootprint GetFootprint();
+
+			// Runs a full pass ignoring the frame budget and prints the footprint before and after
+			static void CompactNow();
+
+		private:
+			enum class EntryKind : std::uint8_t {
+				Actor,
+				KillCount,
+				Transient,
+			};
+
+			struct PendingEntry {
+				FormID id = 0;
+				EntryKind kind = EntryKind::Actor;
+			};
+
+			void BeginPass();
+			// Returns true once every pending entry was visited
+			bool Step(double a_budgetMs);
+			void EndPass();
+
+			bool ShouldEvictActorData(FormID id, Actor* actor, const ActorData& data) const;
+			bool ShouldEvictKillCountData(FormID id, Actor* actor, const KillCountData& data) const;
+			bool ShouldEvictTransientData(FormID id, Actor* actor) const;
+
+			std::vector<PendingEntry> pending;
+			std::size_t cursor = 0;
+			bool active = false;
+
+			std::unordered_set<FormID> loaded;
+			float daysPassed = 0.0f;
+			double worldTime = 0.0;
+
+			// Transient data does not survive a load so its last seen time only lives here
+			std::unordered_map<FormID, double> transientSeen;
+
+			DataFootprint before;
+			std::size_t evicted = 0;
+	};
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Data/Compactor.hpp"
+#include "Data/PerkCache.hpp"
 #include "Data/Persistent.hpp"
 #include "Data/Plugin.hpp"
 #include "Data/Runtime.hpp"
@@ -0,0 +1,175 @@
+#include "Data/PerkCache.hpp"
+#include "Managers/Console/ConsoleManager.hpp"
+#include "Profiler/Bench.hpp"
+
+namespace GTS {
+
+	PerkCache& PerkCache::GetSingleton() noexcept {
+		static PerkCache instance;
+		return instance;
+	}
+
+	std::string PerkCache::DebugName() {
+		return "::PerkCache";
+	}
+
+	void PerkCache::DataReady() {
+		// Runtime is registered before us, its perk forms are resolved by now
+		std::unique_lock guard(this->lock);
+		this->indexByTag.clear();
+		this->indexByPerk.clear();
+		this->perks.clear();
+		this->entries.clear();
+		this->generation += 1;
+
+		for (const auto& [tag, perk] : Runtime::GetSingleton().perks) {
+			if (!perk.data) {
+				continue;
+			}
+			if (this->perks.size() >= MaxPerks) {
+				log::warn("PerkCache: more than {} perks, {} will be queried directly", MaxPerks, tag);
+				continue;
+			}
+			// Several tags can point to the same form
+			auto [it, inserted] = this->indexByPerk.try_emplace(perk.data, static_cast<std::uint16_t>(this->perks.size()));
+			if (inserted) {
+				this->perks.push_back(perk.data);
+			}
+			this->indexByTag.try_emplace(tag, it->second);
+		}
+		log::info("PerkCache: Indexed {} perks", this->perks.size());
+
+		Bench::Register("perks", Benchmark, "Time perk checks with and without the perk cache");
+	}
+
+	void PerkCache::Reset() {
+		std::unique_lock guard(this->lock);
+		this->entries.clear();
+		this->generation += 1;
+	}
+
+	void PerkCache::ResetActor(Actor* actor) {
+		if (!actor) {
+			return;
+		}
+		std::unique_lock guard(this->lock);
+		this->entries.erase(actor->formID);
+		this->generation += 1;
+	}
+
+	void PerkCache::ActorLoaded(Actor* actor) {
+		// Temporary references reuse form ids, start over whenever an actor comes into the world
+		this->ResetActor(actor);
+	}
+
+	void PerkCache::OnAddPerk(const AddPerkEvent& evt) {
+		// Sent after the engine added the perk
+		this->SetOwned(evt.actor, evt.perk, true);
+	}
+
+	void PerkCache::OnRemovePerk(const RemovePerkEvent& evt) {
+		// Sent right before the engine removes the perk, so this can't be recomputed here
+		this->SetOwned(evt.actor, evt.perk, false);
+	}
+
+	void PerkCache::SetOwned(Actor* actor, const BGSPerk* perk, bool owned) {
+		if (!actor || !perk) {
+			return;
+		}
+		std::unique_lock guard(this->lock);
+		auto index = this->indexByPerk.find(perk);
+		if (index == this->indexByPerk.end()) {
+			return;
+		}
+		auto& entry = this->entries[actor->formID];
+		entry.known.set(index->second);
+		entry.owned.set(index->second, owned);
+		this->generation += 1;
+	}
+
+	std::optional<bool> PerkCache::HasPerk(Actor* actor, std::string_view tag) {
+		if (!actor) {
+			return std::nullopt;
+		}
+		auto& me = GetSingleton();
+
+		std::uint16_t index = 0;
+		std::uint64_t generation = 0;
+		{
+			std::shared_lock guard(me.lock);
+			auto found = me.indexByTag.find(tag);
+			if (found == me.indexByTag.end()) {
+				return std::nullopt;
+			}
+			index = found->second;
+			auto entry = me.entries.find(actor->formID);
+			if (entry != me.entries.end() && entry->second.known.test(index)) {
+				return entry->second.owned.test(index);
+			}
+			generation = me.generation;
+		}
+
+		// Ask the engine outside the lock, perk events may come in from other threads meanwhile
+		const bool owned = actor->HasPerk(me.perks[index]);
+
+		std::unique_lock guard(me.lock);
+		if (me.generation == generation) {
+			auto& entry = me.entries[actor->formID];
+			entry.known.set(index);
+			entry.owned.set(index, owned);
+		}
+		return owned;
+	}
+
+	void PerkCache::Benchmark() {
+		const auto actors = Bench::LoadedActors();
+		if (actors.empty()) {
+			return;
+		}
+
+		std::vector<std::string> tags;
+		{
+			auto& me = GetSingleton();
+			std::shared_lock guard(me.lock);
+			tags.reserve(me.indexByTag.size());
+			for (const auto& tag : me.indexByTag | views::keys) {
+				tags.push_back(tag);
+			}
+		}
+
+		std::size_t mismatches = 0;
+		std::uint64_t liveSink = 0;
+		std::uint64_t cachedSink = 0;
+
+		const double live = Bench::TimeUs(1, [&]() {
+			for (auto actor : actors) {
+				for (const auto& tag : tags) {
+					auto perk = Runtime::GetPerk(tag);
+					liveSink += perk && actor->HasPerk(perk);
+				}
+			}
+		});
+		const double cached = Bench::TimeUs(1, [&]() {
+			for (auto actor : actors) {
+				for (const auto& tag : tags) {
+					cachedSink += HasPerk(actor, tag).value_or(false);
+				}
+			}
+		});
+
+		for (auto actor : actors) {
+			for (const auto& tag : tags) {
+				auto perk = Runtime::GetPerk(tag);
+				if (HasPerk(actor, tag).value_or(false) != (perk && actor->HasPerk(perk))) {
+					mismatches += 1;
+					log::warn("PerkCache: {} on {} does not match the engine", tag, actor->GetDisplayFullName());
+				}
+			}
+		}
+
+		Cprint("--- Perk Cache Benchmark ({} actors, {} perks) ---", actors.size(), tags.size());
+		Cprint("Live: {:.1f} us", live);
+		Cprint("Cached: {:.1f} us", cached);
+		Cprint("Owned perks found: {} live, {} cached, {} mismatches", liveSink, cachedSink, mismatches);
+	}
+}
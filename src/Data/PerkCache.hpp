@@ -0,0 +1,55 @@
+#pragma once
+
+// Per-actor cache of which GTS perks an actor owns
+//
+// Runtime::HasPerk is asked from stomp, crush, vore and actor value hook paths many times per frame,
+// and every call resolved the tag and scanned the actor's perks. Each perk listed in Runtime.toml gets
+// a bit index at DataReady, ownership is filled in lazily per actor and kept current by the AddPerk/RemovePerk hooks.
+
+namespace GTS {
+
+	class PerkCache : public EventListener {
+		public:
+			[[nodiscard]] static PerkCache& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void DataReady() override;
+			virtual void Reset() override;
+			virtual void ResetActor(Actor* actor) override;
+			virtual void ActorLoaded(Actor* actor) override;
+			virtual void OnAddPerk(const AddPerkEvent& evt) override;
+			virtual void OnRemovePerk(const RemovePerkEvent& evt) override;
+
+			// Empty when the tag isn't a known perk, the caller should fall back to the engine
+			static std::optional<bool> HasPerk(Actor* actor, std::string_view tag);
+
+			static void Benchmark();
+
+		private:
+			static constexpr std::size_t MaxPerks = 128;
+			using PerkMask = std::bitset<MaxPerks>;
+
+			struct Entry {
+				PerkMask known;
+				PerkMask owned;
+			};
+
+			struct TagHash {
+				using is_transparent = void;
+				std::size_t operator()(std::string_view a_tag) const noexcept {
+					return std::hash<std::string_view>{}(a_tag);
+				}
+			};
+
+			void SetOwned(Actor* actor, const BGSPerk* perk, bool owned);
+
+			std::unordered_map<std::string, std::uint16_t, TagHash, std::equal_to<>> indexByTag;
+			std::unordered_map<const BGSPerk*, std::uint16_t> indexByPerk;
+			std::vector<BGSPerk*> perks;
+
+			std::unordered_map<FormID, Entry> entries;
+			// Bumped whenever entries are changed by an event, lazy fills computed against an older generation are discarded
+			std::uint64_t generation = 0;
+			mutable std::shared_mutex lock;
+	};
+}
@@ -11,6 +11,18 @@
 
 #include "Utils/ItemDistributor.hpp"
 
+namespace {
+
+	// An evicted entry is kept if its actor came back after the compactor looked at it
+	bool SkipOnSave(const std::unordered_set<FormID>& a_evicted, FormID a_id) {
+		if (!a_evicted.contains(a_id)) {
+			return false;
+		}
+		auto actor = TESForm::LookupByID<Actor>(a_id);
+		return !actor || !actor->Is3DLoaded();
+	}
+}
+
 namespace GTS {
 
 	//-----------------
@@ -47,6 +59,8 @@ namespace GTS {
 		std::unique_lock lock(this->_Lock);
 		ActorDataMap.clear();
 		KillCountDataMap.clear();
+		EvictedActorData.clear();
+		EvictedKillCountData.clear();
 
 		TrackedCameraState = 0;
 		EnableCrawlPlayer = false;
@@ -185,6 +199,9 @@ namespace GTS {
 		std::size_t RecordCount = 0;
 		serde->ReadRecordData(&RecordCount, sizeof(RecordCount));
 
+		// Avoid rehashing over and over while loading large saves
+		Persistent::GetSingleton().ActorDataMap.reserve(RecordCount);
+
 		for (; RecordCount > 0; --RecordCount) {
 			ActorData Data = {};
 
@@ -194,7 +211,7 @@ namespace GTS {
 			serde->ReadRecordData(&ReadFormID, sizeof(ReadFormID));
 
 			//V1
-			DummyRead32(serde);                                                             //0x04 - PAD
+			LoadActorRecordFloat(serde, &Data.last_seen, RecordVersion, 1, 0.0f);          //0x04 - Was PAD, always 0 in older saves
 			LoadActorRecordFloat(serde, &Data.visual_scale, RecordVersion, 1, 1.0f);        //0x08
 			LoadActorRecordFloat(serde, &Data.visual_scale_v, RecordVersion, 1, 0.0f);      //0x1C
 			LoadActorRecordFloat(serde, &Data.target_scale, RecordVersion, 1, 1.0f);        //0x10
@@ -312,8 +329,12 @@ namespace GTS {
 
 	void Persistent::WriteActorData(SKSE::SerializationInterface* serde, const uint8_t Version) {
 
-		const size_t NumOfActorRecords = GetSingleton().ActorDataMap.size();
-		
+		auto& Persistent = GetSingleton();
+		size_t NumOfActorRecords = 0;
+		for (const auto ActorFormID : Persistent.ActorDataMap | views::keys) {
+			NumOfActorRecords += !SkipOnSave(Persistent.EvictedActorData, ActorFormID);
+		}
+
 		if (!serde->OpenRecord(ActorDataRecord, Version)) {
 			log::critical("Unable to open ActorDataRecord in CoSave. Something is really wrong, your save is probably broken!");
 			return;
@@ -321,11 +342,14 @@ namespace GTS {
 
 		serde->WriteRecordData(&NumOfActorRecords, sizeof(NumOfActorRecords));
 
-		for (auto const& [ActorFormID, Data] : GetSingleton().ActorDataMap) {
+		for (auto const& [ActorFormID, Data] : Persistent.ActorDataMap) {
+			if (SkipOnSave(Persistent.EvictedActorData, ActorFormID)) {
+				continue;
+			}
 
 			//V1
 			WriteActorRecordFormID(serde, &ActorFormID);                    //0x00 - FORMID
-			DummyWrite32(serde);                                            //0x04 - PAD
+			WriteActorRecordFloat(serde, &Data.last_seen);                  //0x04 - Was PAD
 			WriteActorRecordFloat(serde, &Data.visual_scale);               //0x08
 			WriteActorRecordFloat(serde, &Data.visual_scale_v);             //0x1C
 			WriteActorRecordFloat(serde, &Data.target_scale);               //0x10
@@ -402,6 +426,16 @@ namespace GTS {
 	// ActorData Other
 	//-----------------
 
+	std::vector<FormID> Persistent::GetActorDataIds() const {
+		std::unique_lock lock(this->_Lock);
+		std::vector<FormID> result;
+		result.reserve(this->ActorDataMap.size());
+		for (const auto& key : this->ActorDataMap | views::keys) {
+			result.push_back(key);
+		}
+		return result;
+	}
+
 	ActorData* Persistent::GetActorData(Actor* actor) {
 		if (!actor) {
 			return nullptr;
@@ -480,7 +514,6 @@ namespace GTS {
 		// actor values etc when the cell resets
 		auto data = this->GetData(actor);
 		if (data) {
-			data->PAD_00 = 0.0f;
 			data->visual_scale = 1.0f; 
 			data->target_scale = 1.0f; 
 			data->max_scale = 65535.0f;
@@ -575,6 +608,8 @@ namespace GTS {
 			return;
 		}
 
+		Persistent::GetSingleton().KillCountDataMap.reserve(RecordCount);
+
 		for (; RecordCount > 0; --RecordCount) {
 
 			KillCountData Data = {};
@@ -612,7 +647,11 @@ namespace GTS {
 
 	void Persistent::WriteKillCountData(SKSE::SerializationInterface* serde, const uint8_t Version) {
 
-		const size_t NumOfActorRecords = GetSingleton().KillCountDataMap.size();
+		auto& Persistent = GetSingleton();
+		size_t NumOfActorRecords = 0;
+		for (const auto ActorFormID : Persistent.KillCountDataMap | views::keys) {
+			NumOfActorRecords += !SkipOnSave(Persistent.EvictedKillCountData, ActorFormID);
+		}
 		constexpr uint32_t SizeOfStructDataToWrite = sizeof(KillCountData);
 
 		if (!serde->OpenRecord(KillCountDataRecord, Version)) {
@@ -623,7 +662,10 @@ namespace GTS {
 		serde->WriteRecordData(&NumOfActorRecords, sizeof(size_t));         //0x00 - NumOfRecords
 		serde->WriteRecordData(&SizeOfStructDataToWrite, sizeof(uint32_t)); //0x08 - Struct Size
 
-		for (auto const& [ActorFormID, Data] : GetSingleton().KillCountDataMap) {
+		for (auto const& [ActorFormID, Data] : Persistent.KillCountDataMap) {
+			if (SkipOnSave(Persistent.EvictedKillCountData, ActorFormID)) {
+				continue;
+			}
 
 			//V1
 			WriteActorRecordFormID(serde, &ActorFormID);                    //0x00 - FORMID
@@ -14,7 +14,7 @@ namespace GTS {
 	struct ActorData {
 
 		/// --------- V1
-		float PAD_00 = 0.0f; 
+		float last_seen = 0.0f; // Was PAD_00. In-game days when the actor was last loaded, 0 if not yet seen
 		float visual_scale = 1.0f;
 		float visual_scale_v = 0.0f;
 		float target_scale = 1.0f;
@@ -119,6 +119,8 @@ namespace GTS {
 
 	class Persistent : public EventListener {
 
+		friend class DataCompactor;
+
 		public:
 
 			virtual void Reset() override;
@@ -145,6 +147,9 @@ namespace GTS {
 			KillCountData* GetKillCountData(Actor& actor);
 			KillCountData* GetKillCountData(Actor* actor);
 
+			// Every actor with saved scale data
+			std::vector<FormID> GetActorDataIds() const;
+
 			ActorData* GetActorData(Actor& actor);
 			ActorData* GetActorData(Actor* actor);
 			ActorData* GetData(TESObjectREFR* refr);
@@ -202,6 +207,11 @@ namespace GTS {
 			std::unordered_map<FormID, ActorData> ActorDataMap;
 			std::unordered_map<FormID, KillCountData> KillCountDataMap;
 
+			// Entries DataCompactor evicted. They stay in the maps because other code holds pointers to them
+			// and GetData reads without the lock, they are just left out of the next save
+			std::unordered_set<FormID> EvictedActorData;
+			std::unordered_set<FormID> EvictedKillCountData;
+
 			void ClearData();
 			static void LoadModLocalModConfiguration();
 
@@ -1,4 +1,5 @@
 #include "Data/Runtime.hpp"
+#include "Managers/EffectScheduler.hpp"
 
 namespace {
 
@@ -379,6 +380,9 @@ namespace GTS {
 	}
 
 	bool Runtime::HasPerkOr(Actor* actor, const std::string_view& tag, const bool& default_value) {
+		if (const auto cached = PerkCache::HasPerk(actor, tag)) {
+			return *cached;
+		}
 		auto data = Runtime::GetPerk(tag);
 		if (data) {
 			return actor->HasPerk(data);
@@ -427,6 +431,9 @@ namespace GTS {
 	void Runtime::CreateExplosionAtPos(Actor* actor, NiPoint3 pos, const float& scale, const std::string_view& tag) {
 		auto data = GetExplosion(tag);
 		if (data) {
+			if (EffectScheduler::QueueExplosion(actor, data, pos, scale, false)) {
+				return;
+			}
 			NiPointer<TESObjectREFR> instance_ptr = actor->PlaceObjectAtMe(data, false);
 			if (!instance_ptr) {
 				return;
@@ -41,6 +41,17 @@ namespace GTS {
 		float OverkillSizeBonus = 1.0f;
 		float Overkills = 0.0f;
 
+		// Last values apply_height wrote, an actor whose inputs all still match skips the model write
+		float AppliedVisualScale = -1.0f;
+		float AppliedGameScale = -1.0f;
+		float AppliedInitialScale = -1.0f;
+		float AppliedModelScale = -1.0f;
+		// What the engine side looked like at that write: the SetScale value and the 3D root, which changes on every reload
+		std::uint16_t AppliedRefScale = 0;
+		const NiAVObject* AppliedModel = nullptr;
+		// Set by every scale write site (MarkScaleDirty), while clear apply_height reads nothing from the model
+		bool ScaleDirty = true;
+
 		int Stacks_Perk_CataclysmicStomp = 0;
 		int Stacks_Perk_LifeForce = 0;
 		int CrushSound_Calc_CrushedTinies = 0;
@@ -117,6 +128,8 @@ namespace GTS {
 
 	class Transient : public EventListener {
 
+		friend class DataCompactor;
+
 		public:
 
 			[[nodiscard]] static Transient& GetSingleton() noexcept;
@@ -1,4 +1,5 @@
 #include "Events/Events.hpp"
+#include "Profiler/FrameBenchmark.hpp"
 
 namespace GTS {
 
@@ -7,7 +8,7 @@ namespace GTS {
 
 	void EventListener::BoneUpdate() {}
 
-	// Called on Papyrus OnUpdate
+	// Called at a fixed rate by PapyrusScheduler (Advanced.fPapyrusUpdateRate)
 	void EventListener::PapyrusUpdate() {}
 
 	// Called on Havok update (when processing hitjobs)
@@ -71,13 +72,32 @@ namespace GTS {
 	// Fired when actor uses furniture
 	void EventListener::FurnitureEvent(RE::Actor* user, TESObjectREFR* object, bool enter) {}
 
+	// Fired when a magic effect is applied to an actor (the ActiveEffect may not exist yet)
+	void EventListener::MagicEffectApply(Actor* target, EffectSetting* effect) {}
+
+	// Fired when a non actor reference's 3D loads/unloads or its cell attaches/detaches
+	void EventListener::ReferenceLoaded(TESObjectREFR* ref, bool loaded) {}
+
 	void EventDispatcher::AddListener(EventListener* listener) {
 		if (listener) {
 			EventDispatcher::GetSingleton().listeners.push_back(listener);
 		}
 	}
 
+	const std::vector<EventListener*>& EventDispatcher::GetListeners() {
+		return EventDispatcher::GetSingleton().listeners;
+	}
+
 	void EventDispatcher::DoUpdate() {
+		if (FrameBenchmark::IsRecording()) {
+			for (auto listener: EventDispatcher::GetSingleton().listeners) {
+				const auto start = std::chrono::steady_clock::now();
+				listener->Update();
+				FrameBenchmark::AddSample(listener, std::chrono::steady_clock::now() - start);
+			}
+			FrameBenchmark::EndFrame();
+			return;
+		}
 		for (auto listener: EventDispatcher::GetSingleton().listeners) {
 			GTS_PROFILE_SCOPE(listener->DebugName());
 			listener->Update();
@@ -88,7 +108,6 @@ namespace GTS {
 		for (auto listener: EventDispatcher::GetSingleton().listeners) {
 			GTS_PROFILE_SCOPE(listener->DebugName());
 			listener->BoneUpdate();
-			log::info("BoneUpdateRunning");
 		}
 	}
 
@@ -247,6 +266,20 @@ namespace GTS {
 		}
 	}
 
+	void EventDispatcher::DoMagicEffectApply(Actor* target, EffectSetting* effect) {
+		for (auto listener: EventDispatcher::GetSingleton().listeners) {
+			GTS_PROFILE_SCOPE(listener->DebugName());
+			listener->MagicEffectApply(target, effect);
+		}
+	}
+
+	void EventDispatcher::DoReferenceLoaded(TESObjectREFR* ref, bool loaded) {
+		for (auto listener: EventDispatcher::GetSingleton().listeners) {
+			GTS_PROFILE_SCOPE(listener->DebugName());
+			listener->ReferenceLoaded(ref, loaded);
+		}
+	}
+
 	EventDispatcher& EventDispatcher::GetSingleton() {
 		static EventDispatcher instance;
 		return instance;
@@ -279,7 +279,7 @@ namespace GTS {
 
 			virtual void BoneUpdate();
 
-			// Called on Papyrus OnUpdate
+			// Called at a fixed rate by PapyrusScheduler (Advanced.fPapyrusUpdateRate)
 			virtual void PapyrusUpdate();
 
 			// Called on Havok update (when processing hitjobs)
@@ -342,6 +342,12 @@ namespace GTS {
 
 			// Fired when actor uses furniture
 			virtual void FurnitureEvent(RE::Actor* user, TESObjectREFR* object, bool enter);
+
+			// Fired when a magic effect is applied to an actor (the ActiveEffect may not exist yet)
+			virtual void MagicEffectApply(RE::Actor* target, RE::EffectSetting* effect);
+
+			// Fired when a non actor reference's 3D loads/unloads or its cell attaches/detaches
+			virtual void ReferenceLoaded(RE::TESObjectREFR* ref, bool loaded);
 	};
 
 	class EventDispatcher {
@@ -352,6 +358,7 @@ namespace GTS {
 			// EventDispatcher& operator=(EventDispatcher const&) = delete;
 
 			static void AddListener(EventListener* listener);
+			static const std::vector<EventListener*>& GetListeners();
 			static void DoUpdate();
 			static void DoBoneUpdate();
 			static void DoPapyrusUpdate();
@@ -375,6 +382,8 @@ namespace GTS {
 			static void DoMenuChange(const RE::MenuOpenCloseEvent* menu_event);
 			static void DoActorAnimEvent(RE::Actor* actor, const RE::BSFixedString& a_tag, const RE::BSFixedString& a_payload);
 			static void DoFurnitureEvent(const TESFurnitureEvent* a_event);
+			static void DoMagicEffectApply(RE::Actor* target, RE::EffectSetting* effect);
+			static void DoReferenceLoaded(RE::TESObjectREFR* ref, bool loaded);
 		private:
 			[[nodiscard]] static EventDispatcher& GetSingleton();
 			std::vector<EventListener*> listeners;
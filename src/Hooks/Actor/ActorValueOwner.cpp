@@ -20,7 +20,7 @@ namespace Hooks {
 				if (a_akValue == ActorValue::kCarryWeight) {
 					value = AttributeManager::AlterCarryWeightAV(actor, a_akValue, value);
 				}
-				else if (a_akValue == ActorValue::kSpeedMult && actor->formID != 0x14) {
+				else if (a_akValue == ActorValue::kSpeedMult && actor->formID != 0x14 && AttributeManager::OverridesNPCSpeed(actor)) {
 					value = GetNPCSpeedOverride(actor, value);
 				}
 			}
@@ -16,6 +16,7 @@ namespace Hooks {
 			if (a_event.tag != NULL && a_event.holder != NULL) {
 				Actor* actor = static_cast<Actor*>(a_this);
 				if (actor) {
+					ActorFacts::OnGraphEvent(actor); // The event may set GTS_Busy
 					EventDispatcher::DoActorAnimEvent(actor, a_event.tag, a_event.payload);
 				}
 			}
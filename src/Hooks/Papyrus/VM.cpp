@@ -1,6 +1,8 @@
 #include "Hooks/Papyrus/VM.hpp"
 #include "Hooks/Util/HookUtil.hpp"
 
+#include "Managers/PapyrusScheduler.hpp"
+
 namespace Hooks {
 
 	struct VirtualMachineSendEvent {
@@ -14,7 +16,7 @@ namespace Hooks {
 			func(a_this, a_handle, a_eventName, a_args);
 
 			if (a_eventName == "OnUpdate") {
-				EventDispatcher::DoPapyrusUpdate();
+				PapyrusScheduler::Request();
 			}
 
 		}
@@ -1,5 +1,6 @@
 #include "Hooks/Projectile/Projectiles.hpp"
 #include "Hooks/Util/HookUtil.hpp"
+#include "Utils/Logger.hpp"
 
 using namespace GTS;
 
@@ -11,7 +12,7 @@ namespace {
 			auto cause = causer.get().get();
 			if (cause) {
 				if (IsDragon(cause) || IsGiant(cause)) {
-					log::info("Scaling Explosion");
+					log::deferred_debug("Scaling Explosion");
 					explosion->GetExplosionRuntimeData().radius *= get_visual_scale(cause);
 				}
 			}
@@ -79,7 +80,7 @@ namespace {
 					if (spell) {
 						auto effect = skyrim_cast<SpellItem*>(spell);
 						if (effect) {
-							log::info("Effect found!");
+							log::deferred_debug("Effect found!");
 							effect->data.range *= scaling;
 						}
 					}
@@ -167,36 +167,91 @@ namespace GTS {
 
 		for (auto effect: (*effect_list)) {
 			this->numberOfEffects += 1;
-			if (!this->active_effects.contains(effect)) {
-				EffectSetting* base_spell = effect->GetBaseObject();
-				auto factorySearch = this->factories.find(base_spell);
-				if (factorySearch != this->factories.end()) {
-					auto &[key, factory] = (*factorySearch);
-					auto magic_effect = factory->MakeNew(effect);
-					if (magic_effect) {
-						this->active_effects.try_emplace(effect, magic_effect);
-					}
+			if (!effect || this->tracked.contains(effect)) {
+				continue;
+			}
+			EffectSetting* base_spell = effect->GetBaseObject();
+			auto factorySearch = this->factories.find(base_spell);
+			if (factorySearch != this->factories.end()) {
+				auto &[key, factory] = (*factorySearch);
+				auto magic_effect = factory->MakeNew(effect);
+				if (magic_effect) {
+					this->live.push_back(LiveMagic{ effect, magic_effect, factory.get() });
+					this->tracked.insert(effect);
 				}
 			}
 		}
 	}
 
+	void MagicManager::MarkDirty(Actor* actor) {
+		if (actor) {
+			// A few frames of retries, the apply event can arrive before the effect is in the list
+			constexpr std::uint64_t RescanFrames = 3;
+			std::unique_lock lock(this->dirtyLock);
+			this->dirty.insert_or_assign(actor->formID, Time::FramesElapsed() + RescanFrames);
+		}
+	}
+
+	void MagicManager::ScanDirtyActors() {
+		std::vector<FormID> pending;
+		{
+			std::unique_lock lock(this->dirtyLock);
+			if (this->dirty.empty()) {
+				return;
+			}
+			const auto frame = Time::FramesElapsed();
+			pending.reserve(this->dirty.size());
+			for (auto i = this->dirty.begin(); i != this->dirty.end();) {
+				pending.push_back(i->first);
+				if (frame >= i->second) {
+					i = this->dirty.erase(i);
+				} else {
+					++i;
+				}
+			}
+		}
+
+		for (auto formID: pending) {
+			auto actor = TESForm::LookupByID<Actor>(formID);
+			if (actor) {
+				this->ProcessActiveEffects(actor);
+			}
+		}
+	}
+
+	void MagicManager::ClearLive() {
+		for (auto& entry: this->live) {
+			entry.factory->Destroy(entry.magic);
+		}
+		this->live.clear();
+		this->tracked.clear();
+	}
+
 	std::string MagicManager::DebugName() {
 		return "::MagicManager";
 	}
 
 	void MagicManager::Update() {
 
-		for (auto actor: find_actors()) {
-			this->ProcessActiveEffects(actor);
+		this->ScanDirtyActors();
+
+		// Safety net for effects that never raise an apply event (e.g. restored from a save):
+		// scan one loaded actor per frame instead of all of them
+		auto actors = find_actors();
+		if (!actors.empty()) {
+			this->sweepIndex = (this->sweepIndex + 1) % actors.size();
+			this->ProcessActiveEffects(actors[this->sweepIndex]);
 		}
 
-		for (auto i = this->active_effects.begin(); i != this->active_effects.end();) {
+		for (std::size_t i = 0; i < this->live.size();) {
 			this->numberOfOurEffects += 1;
-			auto& magic = (*i);
-			magic.second->poll();
-			if (magic.second->IsFinished()) {
-				i = this->active_effects.erase(i);
+			auto& entry = this->live[i];
+			entry.magic->poll();
+			if (entry.magic->IsFinished()) {
+				entry.factory->Destroy(entry.magic);
+				this->tracked.erase(entry.effect);
+				this->live[i] = this->live.back();
+				this->live.pop_back();
 			} else {
 				++i;
 			}
@@ -204,7 +259,30 @@ namespace GTS {
 	}
 
 	void MagicManager::Reset() {
-		this->active_effects.clear();
+		this->ClearLive();
+		std::unique_lock lock(this->dirtyLock);
+		this->dirty.clear();
+	}
+
+	void MagicManager::Start() {
+		for (auto actor: find_actors()) {
+			this->MarkDirty(actor);
+		}
+	}
+
+	void MagicManager::ActorLoaded(Actor* actor) {
+		this->MarkDirty(actor);
+	}
+
+	void MagicManager::ActorEquip(Actor* actor) {
+		// Enchantments are applied through equipping
+		this->MarkDirty(actor);
+	}
+
+	void MagicManager::MagicEffectApply(Actor* target, EffectSetting* effect) {
+		if (effect && this->factories.contains(effect)) {
+			this->MarkDirty(target);
+		}
 	}
 
 	void MagicManager::DataReady() {
@@ -44,6 +44,7 @@ namespace GTS {
 			[[nodiscard]] bool HasDuration() const;
 
 			Magic(ActiveEffect* effect);
+			virtual ~Magic() = default;
 
 			[[nodiscard]] inline bool IsFinished() const {
 				return this->state == State::CleanUp;
@@ -70,23 +71,53 @@ namespace GTS {
 
 	class MagicFactoryBase {
 		public:
-			virtual Magic* MakeNew(ActiveEffect* effect) const = 0;
+			virtual Magic* MakeNew(ActiveEffect* effect) = 0;
+			// Destroys a Magic made by this factory and keeps its storage for the next MakeNew
+			virtual void Destroy(Magic* magic) = 0;
 			virtual ~MagicFactoryBase() = default;
 	};
 
 	template<class MagicCls>
 	class MagicFactory : public MagicFactoryBase {
 		public:
-			virtual Magic* MakeNew(ActiveEffect* effect)  const override;
+			virtual Magic* MakeNew(ActiveEffect* effect) override;
+			virtual void Destroy(Magic* magic) override;
+			virtual ~MagicFactory() override;
+
+		private:
+			std::allocator<MagicCls> allocator;
+			std::vector<MagicCls*> pool;
 	};
 
 	template<class MagicCls>
-	Magic* MagicFactory<MagicCls>::MakeNew(ActiveEffect* effect) const {
-		if (effect) {
-			return new MagicCls(effect);
-		} else {
+	Magic* MagicFactory<MagicCls>::MakeNew(ActiveEffect* effect) {
+		if (!effect) {
 			return nullptr;
 		}
+		MagicCls* storage = nullptr;
+		if (this->pool.empty()) {
+			storage = this->allocator.allocate(1);
+		} else {
+			storage = this->pool.back();
+			this->pool.pop_back();
+		}
+		return std::construct_at(storage, effect);
+	}
+
+	template<class MagicCls>
+	void MagicFactory<MagicCls>::Destroy(Magic* magic) {
+		if (magic) {
+			auto storage = static_cast<MagicCls*>(magic);
+			std::destroy_at(storage);
+			this->pool.push_back(storage);
+		}
+	}
+
+	template<class MagicCls>
+	MagicFactory<MagicCls>::~MagicFactory() {
+		for (auto storage: this->pool) {
+			this->allocator.deallocate(storage, 1);
+		}
 	}
 
 	class MagicManager : public EventListener {
@@ -99,6 +130,10 @@ namespace GTS {
 			virtual void Update() override;
 			virtual void Reset() override;
 			virtual void DataReady() override;
+			virtual void Start() override;
+			virtual void ActorLoaded(Actor* actor) override;
+			virtual void ActorEquip(Actor* actor) override;
+			virtual void MagicEffectApply(Actor* target, EffectSetting* effect) override;
 
 			void ProcessActiveEffects(Actor* actor);
 
@@ -112,9 +147,28 @@ namespace GTS {
 
 			void PrintReport();
 		private:
-			std::map<ActiveEffect*, std::unique_ptr<Magic> > active_effects;
+			struct LiveMagic {
+				ActiveEffect* effect = nullptr;
+				Magic* magic = nullptr;
+				MagicFactoryBase* factory = nullptr;
+			};
+
+			// Queue an actor for an effect list scan, safe to call from any thread
+			void MarkDirty(Actor* actor);
+			void ScanDirtyActors();
+			void ClearLive();
+
+			// Flat list of running effects, finished ones are swapped out
+			std::vector<LiveMagic> live;
+			std::unordered_set<ActiveEffect*> tracked;
 			std::unordered_map<EffectSetting*, std::unique_ptr<MagicFactoryBase> > factories;
 
+			// Actors whose effect lists need a scan, kept for a few frames since
+			// the apply event fires before the ActiveEffect is added to the list
+			std::mutex dirtyLock;
+			std::unordered_map<FormID, std::uint64_t> dirty;
+			std::size_t sweepIndex = 0;
+
 			std::uint64_t numberOfEffects = 0;
 			std::uint64_t numberOfOurEffects = 0;
 	};
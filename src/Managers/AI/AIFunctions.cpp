@@ -123,6 +123,10 @@ namespace GTS {
 		return new_speed;
 	}
 
+	bool ShouldOverrideNPCSpeed(Actor* giant) {
+		return (Config::GetAI().bSlowMovementDown || Config::GetAI().bSlowRotationDown) && ShouldBeAltered(giant);
+	}
+
 	float GetScareThreshold(Actor* giant) {
 		float threshold = 2.5f;
 		if (giant->IsSneaking()) { // If we sneak/prone/crawl = make threshold bigger so it's harder to scare actors
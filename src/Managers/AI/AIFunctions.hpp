@@ -3,6 +3,8 @@
 namespace GTS {
 
 	float GetNPCSpeedOverride(Actor* giant, float incoming_speed);
+	// False when GetNPCSpeedOverride would return the speed unchanged
+	bool ShouldOverrideNPCSpeed(Actor* giant);
 	float GetScareThreshold(Actor* giant);
 	void Task_InitHavokTask(Actor* tiny);
 	void SendDeathEvent(Actor* giant, Actor* tiny);
@@ -148,8 +148,6 @@ namespace {
 		std::string name = std::format("HandCollide_R_{}", actor->formID);
 		auto gianthandle = actor->CreateRefHandle();
 
-		std::vector<ObjectRefHandle> Objects = GetNearbyObjects(actor);
-
 		TaskManager::Run(name, [=](auto& progressData) {
 			if (!gianthandle) {
 				return false;
@@ -159,11 +157,11 @@ namespace {
 			auto Arm = find_node(giant, "NPC R Hand [RHnd]");
 			if (Uarm) {
 				DoDamageAtPoint_Cooldown(giant, Radius_Sneak_HandSwipe, Damage_Crawl_HandSwipe * power, Uarm, NiPoint3(0,0,0), 10, 0.30f, crush, pushpower, DamageSource::HandSwipeRight);
-				PushObjects(Objects, giant, Uarm, pushpower, Radius_Sneak_HandSwipe, false);
+				PushObjects(giant, Uarm, pushpower, Radius_Sneak_HandSwipe, false);
 			}
 			if (Arm) {
 				DoDamageAtPoint_Cooldown(giant, Radius_Sneak_HandSwipe, Damage_Crawl_HandSwipe * power, Arm, NiPoint3(0,0,0), 10, 0.30f, crush, pushpower, DamageSource::HandSwipeRight);
-				PushObjects(Objects, giant, Arm, pushpower, Radius_Sneak_HandSwipe, false);
+				PushObjects(giant, Arm, pushpower, Radius_Sneak_HandSwipe, false);
 			}
 			return true;
 		});
@@ -173,8 +171,6 @@ namespace {
 		std::string name = std::format("HandCollide_L_{}", actor->formID);
 		auto gianthandle = actor->CreateRefHandle();
 
-		std::vector<ObjectRefHandle> Objects = GetNearbyObjects(actor);
-
 		TaskManager::Run(name, [=](auto& progressData) {
 			if (!gianthandle) {
 				return false;
@@ -184,11 +180,11 @@ namespace {
 			auto Arm = find_node(giant, "NPC L Hand [LHnd]");
 			if (Uarm) {
 				DoDamageAtPoint_Cooldown(giant, Radius_Sneak_HandSwipe, Damage_Crawl_HandSwipe * power, Uarm, NiPoint3(0,0,0), 10, 0.30f, crush, pushpower, DamageSource::HandSwipeLeft);
-				PushObjects(Objects, giant, Uarm, pushpower, Radius_Sneak_HandSwipe, false);
+				PushObjects(giant, Uarm, pushpower, Radius_Sneak_HandSwipe, false);
 			}
 			if (Arm) {
 				DoDamageAtPoint_Cooldown(giant, Radius_Sneak_HandSwipe, Damage_Crawl_HandSwipe * power, Arm, NiPoint3(0,0,0), 10, 0.30f, crush, pushpower, DamageSource::HandSwipeLeft);
-				PushObjects(Objects, giant, Arm, pushpower, Radius_Sneak_HandSwipe, false);
+				PushObjects(giant, Arm, pushpower, Radius_Sneak_HandSwipe, false);
 			}
 			return true;
 		});
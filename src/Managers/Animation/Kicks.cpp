@@ -31,8 +31,6 @@ namespace {
 		std::string name = std::format("LegKick_{}", actor->formID);
 		auto gianthandle = actor->CreateRefHandle();
 
-		std::vector<ObjectRefHandle> Objects = GetNearbyObjects(actor);
-
 		TaskManager::Run(name, [=](auto& progressData) {
 			if (!gianthandle) {
 				return false;
@@ -43,7 +41,7 @@ namespace {
 				auto coords = GetFootCoordinates(actor, Right, false);
 				if (!coords.empty()) {
 					DoDamageAtPoint_Cooldown(giant, Radius_Kick, power, Leg, coords[1], 10, 0.30f, crush, pushpower, Source); // At Toe point
-					PushObjects(Objects, giant, Leg, pushpower, Radius_Kick, true);
+					PushObjects(giant, Leg, pushpower, Radius_Kick, true);
 				}
 			}
 			return true;
@@ -11,8 +11,6 @@ namespace {
 		std::string name = std::format("SwipeCollide_R_{}", actor->formID);
 		auto gianthandle = actor->CreateRefHandle();
 
-		std::vector<ObjectRefHandle> Objects = GetNearbyObjects(actor);
-
 		TaskManager::Run(name, [=](auto& progressData) {
 			if (!gianthandle) {
 				return false;
@@ -22,11 +20,11 @@ namespace {
 			auto Arm = find_node(giant, "NPC R Hand [RHnd]");
 			if (Uarm) {
 				DoDamageAtPoint_Cooldown(giant, Radius_Sneak_HandSwipe, power, Uarm, NiPoint3(0,0,0), 10, 0.30f, crush, pushpower, DamageSource::HandSwipeRight);
-				PushObjects(Objects, actor, Uarm, pushpower, Radius_Sneak_HandSwipe, false);
+				PushObjects(actor, Uarm, pushpower, Radius_Sneak_HandSwipe, false);
 			}
 			if (Arm) {
 				DoDamageAtPoint_Cooldown(giant, Radius_Sneak_HandSwipe, power, Arm, NiPoint3(0,0,0), 10, 0.30f, crush, pushpower, DamageSource::HandSwipeRight);
-				PushObjects(Objects, actor, Arm, pushpower, Radius_Sneak_HandSwipe, false);
+				PushObjects(actor, Arm, pushpower, Radius_Sneak_HandSwipe, false);
 			}
 
 			Utils_UpdateHighHeelBlend(giant, false);
@@ -39,8 +37,6 @@ namespace {
 		std::string name = std::format("SwipeCollide_L_{}", actor->formID);
 		auto gianthandle = actor->CreateRefHandle();
 
-		std::vector<ObjectRefHandle> Objects = GetNearbyObjects(actor);
-
 		TaskManager::Run(name, [=](auto& progressData) {
 			if (!gianthandle) {
 				return false;
@@ -50,11 +46,11 @@ namespace {
 			auto Arm = find_node(giant, "NPC L Hand [LHnd]");
 			if (Uarm) {
 				DoDamageAtPoint_Cooldown(giant, Radius_Sneak_HandSwipe, power, Uarm, NiPoint3(0,0,0), 10, 0.30f, crush, pushpower, DamageSource::HandSwipeLeft);
-				PushObjects(Objects, actor, Uarm, pushpower, Radius_Sneak_HandSwipe, false);
+				PushObjects(actor, Uarm, pushpower, Radius_Sneak_HandSwipe, false);
 			}
 			if (Arm) {
 				DoDamageAtPoint_Cooldown(giant, Radius_Sneak_HandSwipe, power, Arm, NiPoint3(0,0,0), 10, 0.30f, crush, pushpower, DamageSource::HandSwipeLeft);
-				PushObjects(Objects, actor, Arm, pushpower, Radius_Sneak_HandSwipe, false);
+				PushObjects(actor, Arm, pushpower, Radius_Sneak_HandSwipe, false);
 			}
 
 			Utils_UpdateHighHeelBlend(giant, false);
@@ -153,23 +153,11 @@ namespace {
 		std::string taskname = std::format("DelayLaunch_{}", giant->formID);
 		ActorHandle giantHandle = giant->CreateRefHandle();
 
-		double Start = Time::WorldTimeElapsed();
-
-		TaskManager::Run(taskname, [=](auto& update){ // Needed to prioritize grind over launch
+		TimerManager::After(taskname, 0.03, [=]() { // Needed to prioritize grind over launch
 			if (!giantHandle) {
-				return false;
-			}
-			Actor* giantref = giantHandle.get().get();
-			double Finish = Time::WorldTimeElapsed();
-
-			double timepassed = Finish - Start;
-
-			if (timepassed > 0.03) {
-				LaunchTask(giantref, radius, power, Event);
-				return false;
+				return;
 			}
-
-			return true;
+			LaunchTask(giantHandle.get().get(), radius, power, Event);
 		});
 	}
 
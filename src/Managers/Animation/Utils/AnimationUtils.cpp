@@ -68,21 +68,6 @@ namespace {
 
 namespace GTS {
 
-	constexpr std::string_view leftFootLookup = "NPC L Foot [Lft ]";
-	constexpr std::string_view rightFootLookup = "NPC R Foot [Rft ]";
-
-	constexpr std::string_view leftCalfLookup = "NPC L Calf [LClf]";
-	constexpr std::string_view rightCalfLookup = "NPC R Calf [RClf]";
-
-	constexpr std::string_view leftCalfLookup_failed = "NPC L Calf [LClf]";
-	constexpr std::string_view rightCalfLookup_failed = "NPC R Calf [RClf]";
-
-	constexpr std::string_view leftToeLookup_failed = "NPC L Toe0 [LToe]";
-	constexpr std::string_view rightToeLookup_failed = "NPC R Toe0 [RToe]";
-
-	constexpr std::string_view leftToeLookup = "NPC L Joint 3 [Lft ]";
-	constexpr std::string_view rightToeLookup = "NPC R Joint 3 [Rft ]";
-
 	void RestoreBreastAttachmentState(Actor* giant, Actor* tiny) { // Fixes tiny going under our foot if someone suddenly ragdolls us during breast anims such as Absorb
 		if (IsRagdolled(giant) && Attachment_GetTargetNode(giant) != AttachToNode::None) {
 			Attachment_SetTargetNode(giant, AttachToNode::None);
@@ -857,7 +842,7 @@ namespace GTS {
 			if (HasSMT(actor)) {
 				SCALE_RATIO = 0.8f;
 			}
-			std::vector<NiPoint3> CoordsToCheck = GetFootCoordinates(actor, Right, false);
+			const FootPoints CoordsToCheck = ContactSnapshot::GetFootPoints(actor, Right, false);
 			if (!CoordsToCheck.empty()) {
 				if (IsDebugEnabled() && (actor->formID == 0x14 || IsTeammate(actor))) {
 					for (const auto& footPoints : CoordsToCheck) {
@@ -1274,26 +1259,14 @@ namespace GTS {
 		return coordinates;
 	}
 
-	std::vector<NiPoint3> GetFootCoordinates(Actor* actor, bool Right, bool ignore_rotation) {
+	FootPoints ComputeFootPoints(Actor* actor, bool Right, bool ignore_rotation) {
 		// Get world HH offset
 		NiPoint3 hhOffsetbase = HighHeelManager::GetBaseHHOffset(actor);
-		std::vector<NiPoint3> footPoints = {};
-		std::string_view FootLookup = leftFootLookup;
-		std::string_view CalfLookup = leftCalfLookup;
-		std::string_view ToeLookup = leftToeLookup;
-
-		std::string_view ToeFailed = leftToeLookup_failed;
-		if (Right) {
-			FootLookup = rightFootLookup;
-			CalfLookup = rightCalfLookup;
-			ToeLookup = rightToeLookup;
-
-			ToeFailed = rightToeLookup_failed;
-		}
+		FootPoints footPoints = {};
 
-		auto Foot = find_node(actor, FootLookup);
-		auto Calf = find_node(actor, CalfLookup);
-		auto Toe = find_node(actor, ToeLookup);
+		auto Foot = ContactSnapshot::GetNode(actor, Right ? ContactNode::FootR : ContactNode::FootL);
+		auto Calf = ContactSnapshot::GetNode(actor, Right ? ContactNode::CalfR : ContactNode::CalfL);
+		auto Toe = ContactSnapshot::GetNode(actor, Right ? ContactNode::ToeR : ContactNode::ToeL); // Falls back to Toe0 node
 		if (!Foot) {
 			//log::info("Missing Foot node on {}", actor->GetDisplayFullName());
 			return footPoints;
@@ -1302,10 +1275,7 @@ namespace GTS {
 			return footPoints;
 		}
 		if (!Toe) {
-			Toe = find_node(actor, ToeFailed);
-			if (!Toe) {
-				return footPoints;
-			}
+			return footPoints;
 		}
 		NiMatrix3 RotMat;
 		{
@@ -1341,7 +1311,7 @@ namespace GTS {
 
 		float hh = hhOffsetbase[2] / get_npcparentnode_scale(actor);
 		// Make a list of points to check
-		std::vector<NiPoint3> points = {
+		const std::array<NiPoint3, 3> points = {
 			// x = side, y = forward, z = up/down      
 			NiPoint3(0.0f, hh/10, -(1.0f + hh * 0.25f)), 	// basic foot pos
 			// ^ Point 1: ---()  
@@ -1351,19 +1321,18 @@ namespace GTS {
 			//            -----
 			// ^ Point 3: ---()  
 		};
-		std::tuple<NiAVObject*, NiMatrix3> CoordResult(Foot, RotMat);
 
-		for (const auto& [foot, rotMat]: {CoordResult}) {
-			if (!foot) {
-				return footPoints;
-			}
-			for (NiPoint3 point: points) {
-				footPoints.push_back(foot->world*(rotMat*point));
-			}
+		for (const NiPoint3& point: points) {
+			footPoints.points[footPoints.count++] = Foot->world*(RotMat*point);
 		}
 		return footPoints;
 	}
 
+	std::vector<NiPoint3> GetFootCoordinates(Actor* actor, bool Right, bool ignore_rotation) {
+		const FootPoints points = ContactSnapshot::GetFootPoints(actor, Right, ignore_rotation);
+		return std::vector<NiPoint3>(points.begin(), points.end());
+	}
+
 	NiPoint3 GetHeartPosition(Actor* giant, Actor* tiny, bool hugs) { // It is used to spawn Heart Particles during healing hugs
 
 		NiPoint3 TargetA = NiPoint3();
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Managers/Damage/ContactSnapshot.hpp"
+
 namespace GTS {
 
 	enum class FollowerAnimType {
@@ -59,6 +61,8 @@ namespace GTS {
 	void ApplyFingerDamage(Actor* giant, float radius, float damage, NiAVObject* node, float random, float bbmult, float crushmult, float Shrink, DamageSource Cause);
 
 	std::vector<NiPoint3> GetThighCoordinates(Actor* giant, std::string_view calf, std::string_view feet, std::string_view thigh);
+	// Uncached foot zone points, use ContactSnapshot::GetFootPoints instead
+	FootPoints ComputeFootPoints(Actor* actor, bool Right, bool ignore_rotation);
 	std::vector<NiPoint3> GetFootCoordinates(Actor* actor, bool Right, bool ignore_rotation);
 	NiPoint3 GetHeartPosition(Actor* giant, Actor* tiny, bool hugs);
 
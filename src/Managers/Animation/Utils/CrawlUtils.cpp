@@ -5,6 +5,7 @@
 #include "Managers/Damage/CollisionDamage.hpp"
 #include "Managers/Damage/LaunchActor.hpp"
 #include "Managers/Damage/LaunchPower.hpp"
+#include "Managers/Damage/ContactSnapshot.hpp"
 #include "Managers/Audio/Footstep.hpp"
 #include "Managers/Rumble.hpp"
 
@@ -173,10 +174,10 @@ namespace GTS {
 	}
 
 	void ApplyAllCrawlingDamage(Actor* giant, int random, float bonedamage) { // Applies damage to all 4 crawl bones at once
-		auto LC = find_node(giant, "NPC L Calf [LClf]");
-		auto RC = find_node(giant, "NPC R Calf [RClf]");
-		auto LH = find_node(giant, "NPC L Finger20 [LF20]");
-		auto RH = find_node(giant, "NPC R Finger20 [RF20]");
+		auto LC = ContactSnapshot::GetNode(giant, ContactNode::CalfL);
+		auto RC = ContactSnapshot::GetNode(giant, ContactNode::CalfR);
+		auto LH = ContactSnapshot::GetNode(giant, ContactNode::FingerL);
+		auto RH = ContactSnapshot::GetNode(giant, ContactNode::FingerR);
 		if (!LC) {
 			return;
 		}
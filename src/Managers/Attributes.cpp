@@ -4,6 +4,9 @@
 
 #include "Managers/Damage/TinyCalamity.hpp"
 #include "Managers/GtsSizeManager.hpp"
+#include "Managers/AI/AIFunctions.hpp"
+#include "Managers/Console/ConsoleManager.hpp"
+#include "Profiler/Bench.hpp"
 
 using namespace REL;
 using namespace GTS;
@@ -120,16 +123,107 @@ namespace GTS {
 	void AttributeManager::Update() {
 
 		static Timer timer = Timer(0.5);
+		static PeriodicPrune Prune;
 
-		if (timer.ShouldRunFrame()) { // Run once per 0.5 sec
-			for (auto actor: find_actors()) {
-				if (actor) {
-					if (actor->Is3DLoaded()) {
+		const bool RunPerks = timer.ShouldRunFrame(); // Run once per 0.5 sec
+		for (auto actor: find_actors()) {
+			if (actor) {
+				if (actor->Is3DLoaded()) {
+					if (RunPerks) {
 						UpdateActors(actor);
 					}
+					this->Refresh(actor);
 				}
 			}
 		}
+
+		Prune(this->records, [](const auto& entry) {
+			auto actor = TESForm::LookupByID<Actor>(entry.first);
+			return !actor || !actor->Is3DLoaded();
+		}, this->lock);
+	}
+
+	void AttributeManager::DataReady() {
+		Bench::Register("attributes", Benchmark, "Compare cached attribute bonuses against the formulas and time both");
+	}
+
+	void AttributeManager::Reset() {
+		std::unique_lock guard(this->lock);
+		this->records.clear();
+	}
+
+	void AttributeManager::ResetActor(Actor* actor) {
+		if (actor) {
+			std::unique_lock guard(this->lock);
+			this->records.erase(actor->formID);
+		}
+	}
+
+	AttributeManager::BonusInputs AttributeManager::GatherInputs(Actor* actor) {
+		BonusInputs inputs;
+		inputs.scale = get_giantess_scale(actor);
+		inputs.naturalScale = get_natural_scale(actor, true);
+		inputs.might = Potion_GetMightBonus(actor);
+		inputs.movementSlowdown = GetMovementSlowdown(actor);
+		inputs.carryMult = Config::GetBalance().fStatBonusCarryWeightMult;
+		inputs.damageMult = Config::GetBalance().fStatBonusDamageMult;
+		inputs.balanced = SizeManager::BalancedMode();
+		inputs.alternativeSpeed = Config::GetGeneral().bAlternativeSpeedFormula;
+		if (auto actorData = Persistent::GetSingleton().GetData(actor)) {
+			inputs.smtRunSpeed = actorData->smt_run_speed;
+		}
+		if (actor->formID == 0x14) {
+			inputs.smt = HasSMT(actor);
+			inputs.sprintPerk = actor->AsActorState()->IsSprinting() && Runtime::HasPerk(actor, "GTSPerkSprintDamageMult1");
+		}
+		return inputs;
+	}
+
+	void AttributeManager::Refresh(Actor* actor) {
+		GTS_PROFILE_SCOPE("AttributeManager: Refresh");
+
+		// Update is the only writer, reading here without the lock is fine
+		auto found = this->records.find(actor->formID);
+		AttributeRecord record = found != this->records.end() ? found->second : AttributeRecord();
+		const bool known = found != this->records.end();
+
+		const BonusInputs inputs = GatherInputs(actor);
+		bool changed = !known || inputs != record.inputs;
+		if (changed) {
+			record.inputs = inputs;
+			record.health = CalculateAttributeBonus(actor, ActorValue::kHealth);
+			record.carryWeight = CalculateAttributeBonus(actor, ActorValue::kCarryWeight);
+			record.speed = CalculateAttributeBonus(actor, ActorValue::kSpeedMult);
+			record.damage = CalculateAttributeBonus(actor, ActorValue::kAttackDamageMult);
+			record.jump = CalculateAttributeBonus(actor, ActorValue::kJumpingBonus);
+		}
+
+		const float stolenHealth = GetStolenAttributes_Values(actor, ActorValue::kHealth);
+		const float stolenMagicka = GetStolenAttributes_Values(actor, ActorValue::kMagicka);
+		const float stolenStamina = GetStolenAttributes_Values(actor, ActorValue::kStamina);
+		const bool npcSpeedOverride = actor->formID != 0x14 && ShouldOverrideNPCSpeed(actor);
+		if (stolenHealth != record.stolenHealth || stolenMagicka != record.stolenMagicka || stolenStamina != record.stolenStamina || npcSpeedOverride != record.npcSpeedOverride) {
+			record.stolenHealth = stolenHealth;
+			record.stolenMagicka = stolenMagicka;
+			record.stolenStamina = stolenStamina;
+			record.npcSpeedOverride = npcSpeedOverride;
+			changed = true;
+		}
+
+		if (changed) {
+			std::unique_lock guard(this->lock);
+			this->records[actor->formID] = record;
+		}
+	}
+
+	std::optional<AttributeManager::AttributeRecord> AttributeManager::GetRecord(Actor* actor) {
+		auto& me = GetSingleton();
+		std::shared_lock guard(me.lock);
+		auto found = me.records.find(actor->formID);
+		if (found == me.records.end()) {
+			return std::nullopt;
+		}
+		return found->second;
 	}
 
 	void AttributeManager::OverrideSMTBonus(float Value) {
@@ -147,6 +241,25 @@ namespace GTS {
 			return 1.0f;
 		}
 
+		if (const auto record = GetRecord(actor)) {
+			switch (av) {
+				case ActorValue::kHealth: return record->health;
+				case ActorValue::kCarryWeight: return record->carryWeight;
+				case ActorValue::kSpeedMult: return record->speed;
+				case ActorValue::kAttackDamageMult: return record->damage;
+				case ActorValue::kJumpingBonus: return record->jump;
+				default: return 1.0f;
+			}
+		}
+		return CalculateAttributeBonus(actor, av);
+	}
+
+	float AttributeManager::CalculateAttributeBonus(Actor* actor, ActorValue av) {
+
+		if (!actor) {
+			return 1.0f;
+		}
+
 		float BalancedMode = SizeManager::BalancedMode() ? 2.0f : 1.0f;
 		float natural_scale = get_natural_scale(actor, true);
 		float scale = get_giantess_scale(actor);
@@ -268,7 +381,8 @@ namespace GTS {
 
 			case ActorValue::kHealth: { // 27.03.2024: Health boost is still applied, but for Player only and only if having matching perks
 
-				float perkbonus = GetStolenAttributes_Values(actor, ActorValue::kHealth); // calc health from the perk bonuses
+				const auto record = GetRecord(actor);
+				float perkbonus = record ? record->stolenHealth : GetStolenAttributes_Values(actor, ActorValue::kHealth); // calc health from the perk bonuses
 				float finalValue = originalValue + perkbonus; // add flat health on top
 				auto transient = Transient::GetSingleton().GetData(actor);
 				if (transient) {
@@ -277,11 +391,13 @@ namespace GTS {
 				return finalValue;
 			}
 			case ActorValue::kMagicka: {
-				float perkbonus = GetStolenAttributes_Values(actor, ActorValue::kMagicka);
+				const auto record = GetRecord(actor);
+				float perkbonus = record ? record->stolenMagicka : GetStolenAttributes_Values(actor, ActorValue::kMagicka);
 				return originalValue + perkbonus;
 			}
 			case ActorValue::kStamina: {
-				float perkbonus = GetStolenAttributes_Values(actor, ActorValue::kStamina);
+				const auto record = GetRecord(actor);
+				float perkbonus = record ? record->stolenStamina : GetStolenAttributes_Values(actor, ActorValue::kStamina);
 				return originalValue + perkbonus;
 			}
 
@@ -318,4 +434,64 @@ namespace GTS {
 		}
 		return 1.0f;
 	}
+
+	bool AttributeManager::OverridesNPCSpeed(Actor* actor) {
+		const auto record = GetRecord(actor);
+		// Unknown actors go through the full check in GetNPCSpeedOverride
+		return !record || record->npcSpeedOverride;
+	}
+
+	void AttributeManager::Benchmark() {
+		constexpr std::size_t Rounds = 1000;
+		constexpr std::array Values = {
+			ActorValue::kHealth,
+			ActorValue::kCarryWeight,
+			ActorValue::kSpeedMult,
+			ActorValue::kAttackDamageMult,
+			ActorValue::kJumpingBonus,
+		};
+
+		const auto actors = Bench::LoadedActors();
+		if (actors.empty()) {
+			return;
+		}
+
+		std::size_t checked = 0;
+		std::size_t mismatches = 0;
+		for (auto actor : actors) {
+			if (!GetRecord(actor)) {
+				continue;
+			}
+			for (auto av : Values) {
+				const float cached = GetAttributeBonus(actor, av);
+				const float live = CalculateAttributeBonus(actor, av);
+				checked += 1;
+				if (cached != live) {
+					mismatches += 1;
+					log::warn("AttributeManager: {} av {} cached {} but the formula gives {}", actor->GetDisplayFullName(), std::to_underlying(av), cached, live);
+				}
+			}
+		}
+
+		float sink = 0.0f;
+		const double live = Bench::TimeUs(Rounds, [&]() {
+			for (auto actor : actors) {
+				for (auto av : Values) {
+					sink += CalculateAttributeBonus(actor, av);
+				}
+			}
+		});
+		const double cached = Bench::TimeUs(Rounds, [&]() {
+			for (auto actor : actors) {
+				for (auto av : Values) {
+					sink += GetAttributeBonus(actor, av);
+				}
+			}
+		});
+
+		Cprint("--- Attribute Benchmark ({} actors x {} values x {}) ---", actors.size(), Values.size(), Rounds);
+		Cprint("Formulas: {:.0f} us, Cached: {:.0f} us", live, cached);
+		Cprint("Compared {} cached values, {} differ (the sprint and might bonuses can lag a frame)", checked, mismatches);
+		log::trace("Attribute benchmark sink {}", sink);
+	}
 }
@@ -1,6 +1,9 @@
 #pragma once
 
 // Module that handles AttributeValues
+//
+// The ActorValueOwner hooks run on every engine actor value query, so the bonuses of loaded actors are kept
+// in a table that Update only recomputes when something they depend on (scale, potions, perks, config) changed.
 
 namespace GTS {
 
@@ -15,12 +18,62 @@ namespace GTS {
 
 		virtual std::string DebugName() override;
 		virtual void Update() override;
+		virtual void DataReady() override;
+		virtual void Reset() override;
+		virtual void ResetActor(Actor* actor) override;
 
 		static void OverrideSMTBonus(float Value);
+		// Cached when the actor is loaded, calculated on the spot otherwise
 		static float GetAttributeBonus(Actor* actor, ActorValue av);
+		// Always runs the formulas
+		static float CalculateAttributeBonus(Actor* actor, ActorValue av);
+		// False when the AI speed override can be skipped for this actor
+		static bool OverridesNPCSpeed(Actor* actor);
 		static float AlterCarryWeightAV(Actor* actor, ActorValue av, float originalValue);
 		static float AlterGetBaseAv(Actor* actor, ActorValue av, float originalValue);
 		static float AlterSetBaseAv(Actor* actor, ActorValue av, float originalValue);
 		static float AlterMovementSpeed(Actor* actor);
+
+		static void Benchmark();
+
+		private:
+
+		// Everything CalculateAttributeBonus reads, the bonuses only get recomputed when this changes
+		struct BonusInputs {
+			float scale = 0.0f;
+			float naturalScale = 0.0f;
+			float might = 0.0f;
+			float smtRunSpeed = 0.0f;
+			float movementSlowdown = 0.0f;
+			float carryMult = 0.0f;
+			float damageMult = 0.0f;
+			bool smt = false;
+			bool sprintPerk = false;
+			bool balanced = false;
+			bool alternativeSpeed = false;
+
+			bool operator==(const BonusInputs&) const = default;
+		};
+
+		struct AttributeRecord {
+			BonusInputs inputs;
+			float health = 1.0f;
+			float carryWeight = 1.0f;
+			float speed = 1.0f;
+			float damage = 1.0f;
+			float jump = 1.0f;
+			// Player only
+			float stolenHealth = 0.0f;
+			float stolenMagicka = 0.0f;
+			float stolenStamina = 0.0f;
+			bool npcSpeedOverride = true;
+		};
+
+		static BonusInputs GatherInputs(Actor* actor);
+		static std::optional<AttributeRecord> GetRecord(Actor* actor);
+		void Refresh(Actor* actor);
+
+		std::unordered_map<FormID, AttributeRecord> records;
+		mutable std::shared_mutex lock;
 	};
 }
@@ -93,8 +93,9 @@ namespace GTS {
         logger::trace("Constructed SLVoice Base String: {}", Base);
 
         // Pick one of the three suffixes
+        static const WeightedTable SuffixWeights = { 10, 8, 6 };
         std::string Suffix;
-        switch (RandomIntWeighted(10, 8, 6)) {
+        switch (SuffixWeights.Pick()) {
             default:
             case 0: Suffix = "Mil"; break;
 	        case 1: Suffix = "Mid"; break;
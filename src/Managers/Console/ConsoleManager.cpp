@@ -1,5 +1,6 @@
 #include "Managers/Console/ConsoleManager.hpp"
 #include "Version.hpp"
+#include "Utils/Logger.hpp"
 #include "git.h"
 
 
@@ -94,6 +95,13 @@ namespace GTS {
 			}
 		}
 	}
-}
-
 
+	void ConsoleManager::CMD_LogStats() {
+		const auto stats = log::GetAsyncStats();
+		Cprint("--- Log Stats ---");
+		Cprint("Written: {}", stats.written);
+		Cprint("Dropped (queue full): {}", stats.dropped);
+		Cprint("Rate limited: {}", stats.rateLimited);
+		Cprint("Repeats folded: {}", stats.deduplicated);
+	}
+}
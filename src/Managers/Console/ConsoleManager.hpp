@@ -20,6 +20,7 @@ namespace GTS {
         static void CMD_Help();
         static void CMD_Version();
         static void CMD_Unlimited();
+        static void CMD_LogStats();
 
         public:
 
@@ -35,6 +36,7 @@ namespace GTS {
             RegisterCommand("help", CMD_Help, "Show this list");
             RegisterCommand("version", CMD_Version, "Show plugin version");
             RegisterCommand("unlimited", CMD_Unlimited, "Unlocks max size sliders");
+            RegisterCommand("logstats", CMD_LogStats, "Show how many log lines were written, dropped or suppressed");
         }
 
         static void RegisterCommand(std::string_view a_cmdName, const std::function<void()>& a_callback, const std::string& a_desc);
@@ -108,36 +108,24 @@ namespace GTS {
 
 	void CrushManager::Update() {
 		GTS_PROFILE_SCOPE("CrushManager: Update");
-		for (auto &[tinyId, data]: this->data) {
-			auto tiny = TESForm::LookupByID<Actor>(tinyId);
-			auto giantHandle = data.giant;
-			if (!tiny) {
-				continue;
-			}
-			if (!giantHandle) {
-				continue;
-			}
-			auto giant = giantHandle.get().get();
-			if (!giant) {
-				continue;
-			}
+		this->data.PruneFinished();
 
+		this->data.Advance([](FinisherTable::Slot& slot, Actor* giant, Actor* tiny) {
 			auto transient = Transient::GetSingleton().GetData(tiny);
 			if (transient) {
 				if (!transient->CanBeCrushed && !tiny->IsDead()) {
-					return;
+					return FinisherStep::Wait;
 				}
 			}
 
-			if (data.state == CrushState::Healthy) {
+			if (slot.stage == FinisherStage::Start) {
 				SetReanimatedState(tiny);
-				data.state = CrushState::Crushing;
-			} else if (data.state == CrushState::Crushing) {
+				return FinisherStep::Next;
+			} else {
 				Attacked(tiny, giant);
 
 				float currentSize = get_visual_scale(tiny);
 
-				data.state = CrushState::Crushed;
 				if (giant->formID == 0x14 && IsDragon(tiny)) {
 					CompleteDragonQuest(tiny, ParticleType::Red, tiny->IsDead());
 				}
@@ -202,17 +190,18 @@ namespace GTS {
 				}
 
 				FearChance(giant);
+				return FinisherStep::Done;
 			}
-		}
+		});
 	}
 
 	void CrushManager::Reset() {
-		this->data.clear();
+		this->data.Clear();
 	}
 
 	void CrushManager::ResetActor(Actor* actor) {
 		if (actor) {
-			this->data.erase(actor->formID);
+			this->data.Erase(actor->formID);
 		}
 	}
 
@@ -224,7 +213,7 @@ namespace GTS {
 			return;
 		}
 		if (CrushManager::CanCrush(giant, tiny)) {
-			CrushManager::GetSingleton().data.try_emplace(tiny->formID, giant);
+			CrushManager::GetSingleton().data.Start(giant, tiny);
 		}
 	}
 
@@ -232,8 +221,7 @@ namespace GTS {
 		if (!actor) {
 			return false;
 		}
-		auto& m = CrushManager::GetSingleton().data;
-		return (m.find(actor->formID) != m.end());
+		return CrushManager::GetSingleton().data.Contains(actor->formID);
 	}
 
 	bool CrushManager::CanCrush(Actor* giant, Actor* tiny) {
@@ -254,10 +242,4 @@ namespace GTS {
 		//log::info("Can crush {}", tiny->GetDisplayFullName());
 		return true;
 	}
-
-	CrushData::CrushData(Actor* giant) :
-		delay(Timer(0.01)),
-		state(CrushState::Healthy),
-		giant(giant ? giant->CreateRefHandle() : ActorHandle()) {
-	}
 }
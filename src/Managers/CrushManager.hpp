@@ -1,24 +1,11 @@
 #pragma once
 
+#include "Managers/FinisherTable.hpp"
+
 // Module that handles crushing others
 
 namespace GTS {
 
-	enum class CrushState {
-		Healthy,
-		Crushing,
-		Crushed
-	};
-
-	class CrushData {
-		public:
-			CrushData(Actor* giant);
-
-			CrushState state;
-			Timer delay;
-			ActorHandle giant;
-	};
-
 	class CrushManager : public EventListener {
 		public:
 			[[nodiscard]] static CrushManager& GetSingleton() noexcept;
@@ -32,6 +19,6 @@ namespace GTS {
 			static bool AlreadyCrushed(Actor* actor);
 			static void Crush(Actor* giant, Actor* tiny);
 		private:
-			std::unordered_map<FormID, CrushData> data;
+			FinisherTable data;
 	};
 }
@@ -1,6 +1,7 @@
 #include "Managers/Animation/Utils/CooldownManager.hpp"
 #include "Managers/Animation/Utils/AnimationUtils.hpp"
 #include "Managers/Damage/CollisionDamage.hpp"
+#include "Managers/Damage/DamageBuffer.hpp"
 #include "Managers/Damage/SizeHitEffects.hpp"
 #include "Managers/Damage/TinyCalamity.hpp"
 #include "Managers/Audio/GoreAudio.hpp"
@@ -79,7 +80,7 @@ namespace {
 			// goal of this function is to deal heavily decreased damage on normal walk footsteps to actors
 			// so it won't look silly by dealing 30 damage by briefly colliding with others
 			if (difference > 1.4f) {
-				InflictSizeDamage(giant, tiny, difference * 0.35f);
+				DamageBuffer::AddSizeDamage(giant, tiny, difference * 0.35f);
 			} 
 			return false;
 		}
@@ -169,12 +170,13 @@ namespace GTS {
 		if (!actor) return;
 
 		// Cache frequently used values
-		float giantScale = get_visual_scale(actor) * GetSizeFromBoundingBox(actor);
+		const SizeComponents giantSize = SizeCache::Get(actor);
+		float giantScale = giantSize.visual * giantSize.bbMult;
 		constexpr auto BASE_CHECK_DISTANCE = 180.0f;
 		float SCALE_RATIO = 1.15f;
 		float Calamity = 1.0f;
 
-		bool SMT = HasSMT(actor);
+		bool SMT = giantSize.smt;
 		if (SMT) {
 			if (SupportCalamity) {
 				Calamity = 4.0f;
@@ -184,7 +186,7 @@ namespace GTS {
 		}
 
 		float maxFootDistance = radius * giantScale;
-		std::vector<NiPoint3> CoordsToCheck = GetFootCoordinates(actor, Right, ignore_rotation);
+		const FootPoints CoordsToCheck = ContactSnapshot::GetFootPoints(actor, Right, ignore_rotation);
 
 		if (CoordsToCheck.empty()) return;
 
@@ -215,7 +217,8 @@ namespace GTS {
 			if (distanceSq > maxCheckDistanceSq) continue;
 
 			// Compute scale once instead of in condition
-			float tinyScale = get_visual_scale(otherActor) * GetSizeFromBoundingBox(otherActor);
+			const SizeComponents tinySize = SizeCache::Get(otherActor);
+			float tinyScale = tinySize.visual * tinySize.bbMult;
 			if (giantScale / tinyScale <= SCALE_RATIO) continue;
 
 			int nodeCollisions = 0;
@@ -344,8 +347,8 @@ namespace GTS {
 					SizeHitEffects::PerformInjuryDebuff(giant, tiny, damage_result * bbmult, random);
 
 					ModVulnerability(giant, tiny, damage_result);
-					InflictSizeDamage(giant, tiny, damage_result);
-					CrushCheck(giant, tiny, size_difference, crush_threshold, Cause);
+					DamageBuffer::AddSizeDamage(giant, tiny, damage_result);
+					DamageBuffer::AddCrushCheck(giant, tiny, size_difference, crush_threshold, Cause);
 				}
 			}
 		}
@@ -0,0 +1,118 @@
+#include "Managers/Damage/ContactSnapshot.hpp"
+
+#include "Managers/Animation/Utils/AnimationUtils.hpp"
+
+namespace {
+
+	struct NodeLookup {
+		std::string_view name;
+		std::string_view fallback;
+	};
+
+	// Indexed by ContactNode
+	constexpr std::array<NodeLookup, static_cast<std::size_t>(GTS::ContactNode::Count)> NodeNames = {{
+		{ "NPC L Foot [Lft ]", "" },
+		{ "NPC R Foot [Rft ]", "" },
+		{ "NPC L Calf [LClf]", "" },
+		{ "NPC R Calf [RClf]", "" },
+		{ "NPC L Joint 3 [Lft ]", "NPC L Toe0 [LToe]" },
+		{ "NPC R Joint 3 [Rft ]", "NPC R Toe0 [RToe]" },
+		{ "NPC L Hand [LHnd]", "" },
+		{ "NPC R Hand [RHnd]", "" },
+		{ "NPC L Finger20 [LF20]", "" },
+		{ "NPC R Finger20 [RF20]", "" },
+		{ "L Breast03", "" },
+		{ "R Breast03", "" },
+	}};
+
+}
+
+namespace GTS {
+
+	ContactSnapshot& ContactSnapshot::GetSingleton() noexcept {
+		static ContactSnapshot instance;
+		return instance;
+	}
+
+	std::string ContactSnapshot::DebugName() {
+		return "::ContactSnapshot";
+	}
+
+	void ContactSnapshot::Update() {
+		// Drop actors that weren't queried recently so unloaded actors don't pile up
+		static PeriodicPrune Prune;
+		const std::uint64_t frame = Time::FramesElapsed();
+		Prune(this->entries, [frame](const auto& entry) {
+			return entry.second.frame + 1 < frame;
+		});
+	}
+
+	void ContactSnapshot::Reset() {
+		this->entries.clear();
+	}
+
+	void ContactSnapshot::ResetActor(Actor* actor) {
+		// 3D may have been rebuilt, cached node pointers are no longer valid
+		if (actor) {
+			this->entries.erase(actor->formID);
+		}
+	}
+
+	NiAVObject* ContactSnapshot::LookupNode(Actor* actor, ContactNode node) {
+		const auto& lookup = NodeNames[static_cast<std::size_t>(node)];
+		NiAVObject* result = find_node(actor, lookup.name);
+		if (!result && !lookup.fallback.empty()) {
+			result = find_node(actor, lookup.fallback);
+		}
+		return result;
+	}
+
+	ContactSnapshot::Entry* ContactSnapshot::GetEntry(Actor* actor) {
+		if (!OnMainUpdateThread()) {
+			return nullptr;
+		}
+		const std::uint64_t frame = Time::FramesElapsed();
+		auto& entry = this->entries[actor->formID];
+		if (entry.frame != frame) {
+			entry.frame = frame;
+			entry.resolvedNodes = 0;
+			entry.resolvedFeet = 0;
+		}
+		return &entry;
+	}
+
+	NiAVObject* ContactSnapshot::GetNode(Actor* actor, ContactNode node) {
+		if (!actor || node == ContactNode::Count) {
+			return nullptr;
+		}
+		auto entry = GetSingleton().GetEntry(actor);
+		if (!entry) {
+			return LookupNode(actor, node);
+		}
+		const auto index = static_cast<std::size_t>(node);
+		const std::uint32_t bit = 1u << index;
+		if (!(entry->resolvedNodes & bit)) {
+			entry->nodes[index] = LookupNode(actor, node);
+			entry->resolvedNodes |= bit;
+		}
+		return entry->nodes[index];
+	}
+
+	FootPoints ContactSnapshot::GetFootPoints(Actor* actor, bool right, bool ignore_rotation) {
+		if (!actor) {
+			return {};
+		}
+		auto entry = GetSingleton().GetEntry(actor);
+		if (!entry) {
+			return ComputeFootPoints(actor, right, ignore_rotation);
+		}
+		const std::size_t index = (right ? 2 : 0) + (ignore_rotation ? 1 : 0);
+		const std::uint8_t bit = static_cast<std::uint8_t>(1u << index);
+		if (!(entry->resolvedFeet & bit)) {
+			GTS_PROFILE_SCOPE("ContactSnapshot: FootPoints");
+			entry->feet[index] = ComputeFootPoints(actor, right, ignore_rotation);
+			entry->resolvedFeet |= bit;
+		}
+		return entry->feet[index];
+	}
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+// Per-frame memo of the limb nodes and foot zone points used by collision damage
+//
+// Idle foot damage runs DoFootCollision for both feet of every actor each frame and Tiny Calamity
+// asks for the same foot points again for every nearby tiny. The node lookups and foot zone math
+// run on the first query of an actor in a frame and are reused for the rest of it.
+// It holds node pointers and foot points only: no radii, no velocities (UpdateBoneMovementData still
+// records those) and no knee points.
+
+namespace GTS {
+
+	enum class ContactNode : std::uint8_t {
+		FootL,
+		FootR,
+		CalfL,
+		CalfR,
+		ToeL,
+		ToeR,
+		HandL,
+		HandR,
+		FingerL,
+		FingerR,
+		BreastL,
+		BreastR,
+		Count,
+	};
+
+	// Foot zone points: basic foot pos, toe point, under heel point (same layout as GetFootCoordinates)
+	struct FootPoints {
+		std::array<NiPoint3, 3> points = {};
+		std::size_t count = 0;
+
+		[[nodiscard]] bool empty() const { return this->count == 0; }
+		[[nodiscard]] std::size_t size() const { return this->count; }
+		[[nodiscard]] const NiPoint3* begin() const { return this->points.data(); }
+		[[nodiscard]] const NiPoint3* end() const { return this->points.data() + this->count; }
+		[[nodiscard]] const NiPoint3& operator[](std::size_t a_index) const { return this->points[a_index]; }
+	};
+
+	class ContactSnapshot : public EventListener {
+		public:
+			[[nodiscard]] static ContactSnapshot& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+			virtual void ResetActor(Actor* actor) override;
+
+			// Off the main update thread these compute directly without touching the snapshot
+			static NiAVObject* GetNode(Actor* actor, ContactNode node);
+			static FootPoints GetFootPoints(Actor* actor, bool right, bool ignore_rotation);
+
+		private:
+			static constexpr std::size_t NodeCount = static_cast<std::size_t>(ContactNode::Count);
+
+			struct Entry {
+				std::uint64_t frame = std::numeric_limits<std::uint64_t>::max();
+				std::array<NiAVObject*, NodeCount> nodes = {};
+				std::uint32_t resolvedNodes = 0;
+				// [right * 2 + ignore_rotation]
+				std::array<FootPoints, 4> feet = {};
+				std::uint8_t resolvedFeet = 0;
+			};
+
+			static NiAVObject* LookupNode(Actor* actor, ContactNode node);
+			Entry* GetEntry(Actor* actor);
+
+			std::unordered_map<FormID, Entry> entries;
+	};
+}
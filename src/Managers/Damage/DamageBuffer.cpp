@@ -0,0 +1,148 @@
+#include "Managers/Damage/DamageBuffer.hpp"
+
+#include "Managers/Damage/CollisionDamage.hpp"
+#include "Managers/Console/ConsoleManager.hpp"
+
+namespace {
+
+	std::uint64_t MakeKey(const Actor* giant, const Actor* tiny) {
+		return (static_cast<std::uint64_t>(giant->formID) << 32) | tiny->formID;
+	}
+
+	void CMD_DamageStats() {
+		GTS::DamageBuffer::PrintStats();
+	}
+}
+
+namespace GTS {
+
+	DamageBuffer& DamageBuffer::GetSingleton() noexcept {
+		static DamageBuffer instance;
+		return instance;
+	}
+
+	std::string DamageBuffer::DebugName() {
+		return "::DamageBuffer";
+	}
+
+	void DamageBuffer::DataReady() {
+		ConsoleManager::RegisterCommand("damagestats", CMD_DamageStats, "Print how many size damage requests were folded together and the engine actor value calls saved");
+	}
+
+	void DamageBuffer::Update() {
+		Commit();
+	}
+
+	void DamageBuffer::Reset() {
+		this->index.clear();
+		this->pending.clear();
+	}
+
+	DamageBuffer::PendingDamage& DamageBuffer::GetPending(Actor* giant, Actor* tiny) {
+		auto& me = GetSingleton();
+		auto [it, inserted] = me.index.try_emplace(MakeKey(giant, tiny), me.pending.size());
+		if (inserted) {
+			me.pending.push_back(PendingDamage {
+				.giant = giant->CreateRefHandle(),
+				.tiny = tiny->CreateRefHandle(),
+			});
+		}
+		me.requestCount += 1;
+		return me.pending[it->second];
+	}
+
+	void DamageBuffer::AddSizeDamage(Actor* giant, Actor* tiny, float damage) {
+		if (!giant || !tiny) {
+			return;
+		}
+		if (!OnMainUpdateThread()) {
+			InflictSizeDamage(giant, tiny, damage);
+			return;
+		}
+		auto& entry = GetPending(giant, tiny);
+		entry.damage += damage;
+		entry.largestHit = std::max(entry.largestHit, damage);
+		entry.requests += 1;
+	}
+
+	void DamageBuffer::AddCrushCheck(Actor* giant, Actor* tiny, float size_difference, float crush_threshold, DamageSource Cause) {
+		if (!giant || !tiny) {
+			return;
+		}
+		if (!OnMainUpdateThread()) {
+			CollisionDamage::CrushCheck(giant, tiny, size_difference, crush_threshold, Cause);
+			return;
+		}
+		auto& entry = GetPending(giant, tiny);
+		// CrushCheck passes when size_difference > Action_Crush * crush_threshold, keep the request closest to passing
+		if (!entry.crushCheck || size_difference * entry.crushThreshold > entry.crushSizeDifference * crush_threshold) {
+			entry.crushCheck = true;
+			entry.crushSizeDifference = size_difference;
+			entry.crushThreshold = crush_threshold;
+			entry.crushCause = Cause;
+		}
+	}
+
+	void DamageBuffer::Commit() {
+		auto& me = GetSingleton();
+		if (me.pending.empty()) {
+			return;
+		}
+		GTS_PROFILE_SCOPE("DamageBuffer: Commit");
+
+		// Anything queued while committing (e.g. from a crush) goes to the next frame
+		std::vector<PendingDamage> batch;
+		batch.swap(me.pending);
+		me.index.clear();
+
+		const std::uint64_t avCallsBefore = GetEngineAVCallCount();
+
+		// All damage first so every crush check sees the tiny's final health
+		for (const auto& entry : batch) {
+			if (entry.requests == 0) {
+				continue;
+			}
+			auto giant = entry.giant.get().get();
+			auto tiny = entry.tiny.get().get();
+			if (giant && tiny) {
+				InflictSizeDamage(giant, tiny, entry.damage, entry.largestHit);
+			}
+		}
+
+		for (const auto& entry : batch) {
+			if (!entry.crushCheck) {
+				continue;
+			}
+			auto giant = entry.giant.get().get();
+			auto tiny = entry.tiny.get().get();
+			if (giant && tiny) {
+				CollisionDamage::CrushCheck(giant, tiny, entry.crushSizeDifference, entry.crushThreshold, entry.crushCause);
+			}
+		}
+
+		me.commitAVCalls += GetEngineAVCallCount() - avCallsBefore;
+		me.commitCount += batch.size();
+
+		// Keep the allocation around for the next frame
+		if (me.pending.empty()) {
+			batch.clear();
+			me.pending.swap(batch);
+		}
+	}
+
+	void DamageBuffer::PrintStats() {
+		auto& me = GetSingleton();
+		const double callsPerCommit = me.commitCount > 0 ? static_cast<double>(me.commitAVCalls) / static_cast<double>(me.commitCount) : 0.0;
+		const std::uint64_t folded = me.requestCount > me.commitCount ? me.requestCount - me.commitCount : 0;
+
+		Cprint("--- Damage Buffer ---");
+		Cprint("Requests: {}", me.requestCount);
+		Cprint("Pairs committed: {}", me.commitCount);
+		Cprint("Engine AV calls while committing: {} ({:.1f} per pair)", me.commitAVCalls, callsPerCommit);
+		Cprint("Engine AV calls avoided: ~{:.0f}", static_cast<double>(folded) * callsPerCommit);
+
+		me.requestCount = 0;
+		me.commitCount = 0;
+		me.commitAVCalls = 0;
+	}
+}
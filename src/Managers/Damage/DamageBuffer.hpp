@@ -0,0 +1,55 @@
+#pragma once
+
+// Per-frame buffer for size damage
+//
+// A stomp on a crowd runs DoSizeDamage for every foot point touching every tiny, and each call used to read
+// the tiny's health, apply the hit and check for a crush on its own. Damage is now summed per giant/tiny pair
+// and applied once when the frame's damage is committed, followed by a single crush check per pair.
+// Aggro and combat are decided from the largest single hit, so many light touches never add up to a hit
+// that would have made the tiny hostile on its own.
+
+namespace GTS {
+
+	class DamageBuffer : public EventListener {
+		public:
+			[[nodiscard]] static DamageBuffer& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void DataReady() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+
+			// Same as InflictSizeDamage, but summed with everything else the giant does to the tiny this frame.
+			// Off the main thread it is applied right away
+			static void AddSizeDamage(Actor* giant, Actor* tiny, float damage);
+			// Runs CollisionDamage::CrushCheck once after the pair's damage was applied, the easiest to pass request is kept
+			static void AddCrushCheck(Actor* giant, Actor* tiny, float size_difference, float crush_threshold, DamageSource Cause);
+
+			static void Commit();
+			static void PrintStats();
+
+		private:
+			struct PendingDamage {
+				ActorHandle giant;
+				ActorHandle tiny;
+				float damage = 0.0f;
+				float largestHit = 0.0f;
+				std::uint32_t requests = 0;
+
+				bool crushCheck = false;
+				float crushSizeDifference = 0.0f;
+				float crushThreshold = 1.0f;
+				DamageSource crushCause = DamageSource::Crushed;
+			};
+
+			static PendingDamage& GetPending(Actor* giant, Actor* tiny);
+
+			// Keyed by giant form id in the high and tiny form id in the low half, in insertion order
+			std::unordered_map<std::uint64_t, std::size_t> index;
+			std::vector<PendingDamage> pending;
+
+			std::uint64_t requestCount = 0;
+			std::uint64_t commitCount = 0;
+			std::uint64_t commitAVCalls = 0;
+	};
+}
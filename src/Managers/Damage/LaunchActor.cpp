@@ -1,5 +1,6 @@
 #include "Managers/Damage/LaunchActor.hpp"
 #include "Managers/Damage/LaunchPower.hpp"
+#include "Managers/Damage/DamageBuffer.hpp"
 #include "Utils/DeathReport.hpp"
 
 #include "Managers/CrushManager.hpp"
@@ -169,7 +170,7 @@ namespace GTS {
 							damage *= 1.5f;
 						}
 						
-						InflictSizeDamage(giant, tiny, damage);
+						DamageBuffer::AddSizeDamage(giant, tiny, damage);
 					}
 
 					NiPoint3 Push = NiPoint3(0, 0, GetLaunchPowerFor(giant, sizeRatio, LaunchType::Actor_Launch, startpower * force * power));
@@ -5,8 +5,6 @@
 
 #include "Managers/HighHeel.hpp"
 
-#include "RE/T/TES.hpp"
-
 #include "UI/DebugAPI.hpp"
 
 using namespace GTS;
@@ -109,53 +107,45 @@ namespace GTS {
 
 		float start_power = Push_Object_Upwards * (1.0f + Potion_GetMightBonus(giant));
 
-		std::vector<ObjectRefHandle> Refs = GetNearbyObjects(giant);
+		std::vector<NiPoint3> points = footPoints;
+		if (IsFoot) {
+			for (auto& point: points) {
+				point.z -= HH;
+			}
+		}
 
 		if (IsDebugEnabled() && (giant->formID == 0x14 || IsTeammate(giant) || EffectsForEveryone(giant))) {
-			for (auto point: footPoints) {
-				if (IsFoot) {
-					point.z -= HH;
-				}
+			for (const auto& point: points) {
 				DebugAPI::DrawSphere(glm::vec3(point.x, point.y, point.z), maxFootDistance, 600, {0.0f, 1.0f, 0.0f, 1.0f});
 			}
 		}
 
-        for (auto object: Refs) {
-			if (object) {
-				auto objectref = object.get().get();
-				if (objectref) {
-					if (objectref && objectref->Is3DLoaded()) {
-						NiPoint3 objectlocation = objectref->GetPosition();
-						for (auto point: footPoints) {
-							if (IsFoot) {
-								point.z -= HH;
-							}
-							float distance = (point - objectlocation).Length();
-							if (distance <= maxFootDistance) {
-								float force = GetForceFromDistance(distance, maxFootDistance);
-								float push = GetLaunchPowerFor(giant, giantScale, LaunchType::Object_Launch, start_power * force * power) ;
-
-								auto Object1 = objectref->Get3D1(false);
-
-								if (distance <= maxFootDistance / 3.0f) { // Apply only if too close
-									Break_Object(objectref, push, giantScale, smt);
-								}
-
-								if (Object1) {
-									auto collision = Object1->GetCollisionObject();
-									if (collision) {
-										auto body = collision->GetRigidBody();
-										if (body) {
-											push *= Multiply_By_Mass(body);
-											SetLinearImpulse(body, hkVector4(0, 0, push, push));
-										}
-									}
-								}
-							}
-						}
+		TESObjectCELL* cell = Config::GetGameplay().bLaunchAllCells ? nullptr : giant->GetParentCell();
+
+		for (const auto& object: ObjectIndex::Query(points, maxFootDistance, cell)) {
+			bhkRigidBody* body = object.body;
+			bool launched = false;
+			for (const auto& point: points) {
+				float distance = (point - object.position).Length();
+				if (distance <= maxFootDistance) {
+					float force = GetForceFromDistance(distance, maxFootDistance);
+					float push = GetLaunchPowerFor(giant, giantScale, LaunchType::Object_Launch, start_power * force * power) ;
+
+					if (distance <= maxFootDistance / 3.0f) { // Apply only if too close
+						Break_Object(object.ref, push, giantScale, smt);
+						body = ObjectIndex::GetRigidBody(object.ref); // Breaking can swap the model
+					}
+
+					if (body) {
+						push *= Multiply_By_Mass(body);
+						SetLinearImpulse(body, hkVector4(0, 0, push, push));
+						launched = true;
 					}
 				}
 			}
+			if (launched) {
+				ObjectIndex::MarkMoving(object.ref);
+			}
 		}
 	}
     
@@ -244,6 +234,7 @@ namespace GTS {
 
 					ApplyPhysicsToObject_Towards(giantref, ref, EndPos - StartPos, start_power, giantScale);
 					Break_Object(ref, power * 12 * giantScale * start_power, giantScale, smt);
+					ObjectIndex::MarkMoving(ref);
 					return false; // end it
 				}
 				return true;
@@ -251,73 +242,27 @@ namespace GTS {
 		}
 	}
 
-	void PushObjects(const std::vector<ObjectRefHandle>& refs, Actor* giant, NiAVObject* bone, float power, float radius, bool Kick) {
-		if (!refs.empty()) {
-			for (const auto& object: refs) {
-				if (object) {
-					TESObjectREFR* objectref = object.get().get();
-					PushObjectsTowards(giant, objectref, bone, power, radius, Kick);
-				}
-			}
+	void PushObjects(Actor* giant, NiAVObject* bone, float power, float radius, bool Kick) {
+		for (const auto& object: GetNearbyObjects(giant)) {
+			PushObjectsTowards(giant, object.ref, bone, power, radius, Kick);
 		}
 	}
 
-	std::vector<ObjectRefHandle> GetNearbyObjects(Actor* giant) {
+	std::span<const NearbyObject> GetNearbyObjects(Actor* giant) {
 		bool AllowLaunch = Config::GetGameplay().bLaunchObjects;
-		if (!AllowLaunch) {
+		if (!AllowLaunch || !giant) {
 			return {};
 		}
 		float giantScale = get_visual_scale(giant);
 
 		float maxDistance = 220 * giantScale;
 
-		std::vector<ObjectRefHandle> Objects = {};
-		NiPoint3 point = giant->GetPosition();
-
 		const bool PreciseScan = Config::GetGameplay().bLaunchAllCells;
-
-		if (!PreciseScan) { // Scan single cell only
-			TESObjectCELL* cell = giant->GetParentCell();
-			if (cell) {
-				const auto data = cell->GetRuntimeData();
-				for (const auto& object: data.references) {
-					if (object) {
-						const auto objectref = object.get();
-						if (objectref) {
-							const bool IsActor = objectref->Is(FormType::ActorCharacter);
-							if (!IsActor) { // we don't want to apply it to actors
-								const NiPoint3 objectlocation = objectref->GetPosition();
-								const float distance = (point - objectlocation).Length();
-								if (distance <= maxDistance) {
-									ObjectRefHandle refhandle = objectref->CreateRefHandle(); 
-									Objects.push_back(refhandle);
-								}
-							}
-						}
-					}
-				}
-			}
-		}
-    	else { // Else scan Entire world
-			TESObjectREFR* GiantRef = skyrim_cast<TESObjectREFR*>(giant);
-			if (GiantRef) {
-				TESEx::ForEachReferenceInRangeEx(GiantRef, maxDistance, [&](RE::TESObjectREFR* a_ref){
-					const bool IsActor = a_ref->Is(FormType::ActorCharacter);
-					if (!IsActor) { // we don't want to apply it to actors
-						const NiPoint3 objectlocation = a_ref->GetPosition();
-						const float distance = (point - objectlocation).Length();
-						if (distance <= maxDistance) {
-							const ObjectRefHandle handle = a_ref->CreateRefHandle();
-							if (handle) {
-								Objects.push_back(handle);
-							}
-						}
-					}
-					return RE::BSContainer::ForEachResult::kContinue;    
-				});
-			}
+		TESObjectCELL* cell = PreciseScan ? nullptr : giant->GetParentCell(); // Single cell only unless asked otherwise
+		if (!PreciseScan && !cell) {
+			return {};
 		}
-		
-		return Objects;
+
+		return ObjectIndex::Query(giant->GetPosition(), maxDistance, cell);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,355 @@
+#include "Managers/Damage/ObjectIndex.hpp"
+#include "Managers/Console/ConsoleManager.hpp"
+
+#include "RE/T/TES.hpp"
+
+namespace {
+
+	constexpr float GridSize = 1024.0f;
+	// Entries that weren't refreshed yet may have moved a bit since, queries look this much further
+	constexpr float PositionSlack = 256.0f;
+	constexpr std::size_t RefreshPerFrame = 128;
+	// How long a launched object is rebucketed every frame
+	constexpr double MovingTime = 3.0;
+
+	std::int32_t GridCoord(float a_value) {
+		return static_cast<std::int32_t>(std::floor(a_value / GridSize));
+	}
+
+	std::uint64_t MakeGridKey(std::int32_t a_x, std::int32_t a_y) {
+		return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(a_x)) << 32) | static_cast<std::uint32_t>(a_y);
+	}
+
+	std::uint64_t MakeGridKey(const NiPoint3& a_position) {
+		return MakeGridKey(GridCoord(a_position.x), GridCoord(a_position.y));
+	}
+
+	bool IsIndexable(TESObjectREFR* ref) {
+		if (!ref || ref->Is(FormType::ActorCharacter) || ref->IsDeleted()) {
+			return false;
+		}
+		auto base = ref->GetBaseObject();
+		if (!base) {
+			return false;
+		}
+		// Never launched or broken, they are most of a cell's references
+		switch (base->GetFormType()) {
+			case FormType::Static:
+			case FormType::Tree:
+			case FormType::Grass:
+			case FormType::Sound:
+				return false;
+			default:
+				return true;
+		}
+	}
+
+	void RemoveFromBucket(std::vector<std::uint32_t>& a_bucket, std::uint32_t a_slot) {
+		auto found = std::ranges::find(a_bucket, a_slot);
+		if (found != a_bucket.end()) {
+			*found = a_bucket.back();
+			a_bucket.pop_back();
+		}
+	}
+
+	void CMD_ObjectIndexStats() {
+		GTS::ObjectIndex::PrintStats();
+	}
+}
+
+namespace GTS {
+
+	ObjectIndex& ObjectIndex::GetSingleton() noexcept {
+		static ObjectIndex instance;
+		return instance;
+	}
+
+	std::string ObjectIndex::DebugName() {
+		return "::ObjectIndex";
+	}
+
+	void ObjectIndex::DataReady() {
+		ConsoleManager::RegisterCommand("objectindex", CMD_ObjectIndexStats, "Print the size of the launchable object index and how many objects queries looked at");
+	}
+
+	void ObjectIndex::Update() {
+		if (!this->seeded) {
+			this->Seed();
+		}
+
+		std::unique_lock guard(this->lock);
+		const double now = Time::WorldTimeElapsed();
+
+		std::erase_if(this->moving, [&](FormID id) {
+			auto found = this->slotById.find(id);
+			if (found == this->slotById.end()) {
+				return true;
+			}
+			const bool stillMoving = this->entries[found->second].movingUntil > now;
+			return !this->Refresh(found->second) || !stillMoving;
+		});
+
+		for (std::size_t i = 0; i < RefreshPerFrame && !this->entries.empty(); i++) {
+			if (this->refreshCursor >= this->entries.size()) {
+				this->refreshCursor = 0;
+			}
+			// A removed entry is replaced by the last one, look at the same slot again
+			if (this->Refresh(this->refreshCursor)) {
+				this->refreshCursor += 1;
+			}
+		}
+	}
+
+	void ObjectIndex::Reset() {
+		std::unique_lock guard(this->lock);
+		this->entries.clear();
+		this->slotById.clear();
+		this->grid.clear();
+		this->moving.clear();
+		this->refreshCursor = 0;
+		this->seeded = false;
+	}
+
+	void ObjectIndex::ReferenceLoaded(TESObjectREFR* ref, bool loaded) {
+		if (!ref) {
+			return;
+		}
+		std::unique_lock guard(this->lock);
+		if (loaded) {
+			this->Add(ref);
+		}
+		else {
+			this->Remove(ref->formID);
+		}
+	}
+
+	void ObjectIndex::Seed() {
+		GTS_PROFILE_SCOPE("ObjectIndex: Seed");
+		std::vector<TESObjectREFR*> refs;
+		TESEx::ForEachReferenceEx([&](TESObjectREFR* a_ref) {
+			if (IsIndexable(a_ref)) {
+				refs.push_back(a_ref);
+			}
+			return BSContainer::ForEachResult::kContinue;
+		});
+
+		std::unique_lock guard(this->lock);
+		this->entries.reserve(refs.size());
+		for (auto ref : refs) {
+			this->Add(ref);
+		}
+		this->seeded = true;
+		log::info("ObjectIndex: Seeded with {} references", this->entries.size());
+	}
+
+	void ObjectIndex::Add(TESObjectREFR* ref) {
+		if (!IsIndexable(ref)) {
+			return;
+		}
+		auto [found, inserted] = this->slotById.try_emplace(ref->formID, static_cast<std::uint32_t>(this->entries.size()));
+		if (!inserted) {
+			// Temporary references reuse form ids, the position is picked up by the next refresh
+			this->entries[found->second].handle = ref->CreateRefHandle();
+			return;
+		}
+		const NiPoint3 position = ref->GetPosition();
+		const std::uint64_t key = MakeGridKey(position);
+		this->entries.push_back(Entry {
+			.handle = ref->CreateRefHandle(),
+			.id = ref->formID,
+			.gridKey = key,
+			.position = position,
+		});
+		this->grid[key].push_back(found->second);
+	}
+
+	void ObjectIndex::Remove(FormID id) {
+		auto found = this->slotById.find(id);
+		if (found == this->slotById.end()) {
+			return;
+		}
+		const std::uint32_t slot = found->second;
+		this->slotById.erase(found);
+
+		auto bucket = this->grid.find(this->entries[slot].gridKey);
+		if (bucket != this->grid.end()) {
+			RemoveFromBucket(bucket->second, slot);
+			if (bucket->second.empty()) {
+				this->grid.erase(bucket);
+			}
+		}
+
+		const auto last = static_cast<std::uint32_t>(this->entries.size() - 1);
+		if (slot != last) {
+			auto& moved = this->entries[last];
+			auto& movedBucket = this->grid[moved.gridKey];
+			std::ranges::replace(movedBucket, last, slot);
+			this->slotById[moved.id] = slot;
+			this->entries[slot] = std::move(moved);
+		}
+		this->entries.pop_back();
+	}
+
+	bool ObjectIndex::Refresh(std::uint32_t slot) {
+		auto& entry = this->entries[slot];
+		auto ref = entry.handle.get();
+		auto cell = ref ? ref->GetParentCell() : nullptr;
+		if (!ref || ref->IsDeleted() || !cell || !cell->IsAttached()) {
+			this->Remove(entry.id);
+			return false;
+		}
+		entry.position = ref->GetPosition();
+		const std::uint64_t key = MakeGridKey(entry.position);
+		if (key != entry.gridKey) {
+			auto bucket = this->grid.find(entry.gridKey);
+			if (bucket != this->grid.end()) {
+				RemoveFromBucket(bucket->second, slot);
+				if (bucket->second.empty()) {
+					this->grid.erase(bucket);
+				}
+			}
+			this->grid[key].push_back(slot);
+			entry.gridKey = key;
+		}
+		return true;
+	}
+
+	std::span<const NearbyObject> ObjectIndex::Query(const NiPoint3& point, float radius, TESObjectCELL* cell) {
+		return Query(std::span<const NiPoint3>(&point, 1), radius, cell);
+	}
+
+	std::span<const NearbyObject> ObjectIndex::Query(std::span<const NiPoint3> points, float radius, TESObjectCELL* cell) {
+		GTS_PROFILE_SCOPE("ObjectIndex: Query");
+		thread_local std::vector<NearbyObject> result;
+		result.clear();
+		if (points.empty() || radius <= 0.0f) {
+			return result;
+		}
+		auto& me = GetSingleton();
+
+		NiPoint3 low = points.front();
+		NiPoint3 high = points.front();
+		for (const auto& point : points) {
+			low.x = std::min(low.x, point.x);
+			low.y = std::min(low.y, point.y);
+			high.x = std::max(high.x, point.x);
+			high.y = std::max(high.y, point.y);
+		}
+
+		const float reach = radius + PositionSlack;
+		const float reachSq = reach * reach;
+		auto nearAnyPoint = [&](const NiPoint3& a_position, float a_distanceSq) {
+			return std::ranges::any_of(points, [&](const NiPoint3& a_point) {
+				return (a_point - a_position).SqrLength() <= a_distanceSq;
+			});
+		};
+		auto collect = [&](const Entry& a_entry) {
+			if (nearAnyPoint(a_entry.position, reachSq)) {
+				result.push_back(NearbyObject { .handle = a_entry.handle });
+			}
+		};
+
+		{
+			std::shared_lock guard(me.lock);
+			const std::int32_t minX = GridCoord(low.x - reach);
+			const std::int32_t maxX = GridCoord(high.x + reach);
+			const std::int32_t minY = GridCoord(low.y - reach);
+			const std::int32_t maxY = GridCoord(high.y + reach);
+			const auto gridCells = static_cast<std::uint64_t>(maxX - minX + 1) * static_cast<std::uint64_t>(maxY - minY + 1);
+			if (gridCells > me.grid.size()) {
+				// Huge radius, walking the grid would visit mostly empty cells
+				for (const auto& entry : me.entries) {
+					collect(entry);
+				}
+			}
+			else {
+				for (std::int32_t x = minX; x <= maxX; x++) {
+					for (std::int32_t y = minY; y <= maxY; y++) {
+						auto bucket = me.grid.find(MakeGridKey(x, y));
+						if (bucket == me.grid.end()) {
+							continue;
+						}
+						for (auto slot : bucket->second) {
+							collect(me.entries[slot]);
+						}
+					}
+				}
+			}
+		}
+
+		// Resolve outside the lock against the live positions
+		const std::size_t candidates = result.size();
+		const float radiusSq = radius * radius;
+		std::size_t kept = 0;
+		for (std::size_t i = 0; i < candidates; i++) {
+			auto ref = result[i].handle.get().get();
+			if (!ref || ref->IsDisabled() || ref->IsDeleted() || !ref->Is3DLoaded()) {
+				continue;
+			}
+			if (cell && ref->GetParentCell() != cell) {
+				continue;
+			}
+			const NiPoint3 position = ref->GetPosition();
+			if (!nearAnyPoint(position, radiusSq)) {
+				continue;
+			}
+			auto& object = result[kept++];
+			object.handle = result[i].handle;
+			object.ref = ref;
+			object.body = GetRigidBody(ref);
+			object.position = position;
+		}
+		result.resize(kept);
+
+		me.queryCount += 1;
+		me.candidateCount += candidates;
+		me.hitCount += kept;
+		return result;
+	}
+
+	void ObjectIndex::MarkMoving(TESObjectREFR* ref) {
+		if (!ref) {
+			return;
+		}
+		auto& me = GetSingleton();
+		std::unique_lock guard(me.lock);
+		auto found = me.slotById.find(ref->formID);
+		if (found == me.slotById.end()) {
+			return;
+		}
+		const double now = Time::WorldTimeElapsed();
+		auto& entry = me.entries[found->second];
+		if (entry.movingUntil <= now) {
+			me.moving.push_back(entry.id);
+		}
+		entry.movingUntil = now + MovingTime;
+	}
+
+	bhkRigidBody* ObjectIndex::GetRigidBody(TESObjectREFR* ref) {
+		auto node = ref ? ref->Get3D1(false) : nullptr;
+		auto collision = node ? node->GetCollisionObject() : nullptr;
+		return collision ? collision->GetRigidBody() : nullptr;
+	}
+
+	void ObjectIndex::PrintStats() {
+		auto& me = GetSingleton();
+		std::size_t entries = 0;
+		std::size_t buckets = 0;
+		std::size_t moving = 0;
+		{
+			std::shared_lock guard(me.lock);
+			entries = me.entries.size();
+			buckets = me.grid.size();
+			moving = me.moving.size();
+		}
+		const std::uint64_t queries = me.queryCount.exchange(0);
+		const std::uint64_t candidates = me.candidateCount.exchange(0);
+		const std::uint64_t hits = me.hitCount.exchange(0);
+		const double perQuery = queries > 0 ? static_cast<double>(candidates) / static_cast<double>(queries) : 0.0;
+
+		Cprint("--- Object Index ---");
+		Cprint("References: {} in {} grid cells, {} moving", entries, buckets, moving);
+		Cprint("Queries: {} ({:.1f} candidates each)", queries, perQuery);
+		Cprint("Objects returned: {}", hits);
+	}
+}
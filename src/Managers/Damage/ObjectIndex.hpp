@@ -0,0 +1,68 @@
+#pragma once
+
+// Spatial index of loaded non actor references
+//
+// Object launching used to walk every reference of the giant's cell (or every loaded cell with bLaunchAllCells)
+// on each footstep, kick and swipe. References are now kept in a coarse 2D grid that follows cell attach/detach
+// and 3D load/unload, launched objects are rebucketed while they fly and everything else is refreshed a few per frame.
+
+namespace GTS {
+
+	struct NearbyObject {
+		ObjectRefHandle handle;
+		TESObjectREFR* ref = nullptr;
+		// Null when the reference has no havok body, it can still be damaged
+		bhkRigidBody* body = nullptr;
+		NiPoint3 position;
+	};
+
+	class ObjectIndex : public EventListener {
+		public:
+			[[nodiscard]] static ObjectIndex& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void DataReady() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+			virtual void ReferenceLoaded(TESObjectREFR* ref, bool loaded) override;
+
+			// References within radius of any of the points. When cell is set only references of that cell are returned.
+			// The result lives in a per thread buffer and is only valid until the next query on the same thread
+			static std::span<const NearbyObject> Query(const NiPoint3& point, float radius, TESObjectCELL* cell);
+			static std::span<const NearbyObject> Query(std::span<const NiPoint3> points, float radius, TESObjectCELL* cell);
+
+			// Keeps the reference's grid cell up to date every frame while it is flying around
+			static void MarkMoving(TESObjectREFR* ref);
+			static bhkRigidBody* GetRigidBody(TESObjectREFR* ref);
+
+			static void PrintStats();
+
+		private:
+			struct Entry {
+				ObjectRefHandle handle;
+				FormID id = 0;
+				std::uint64_t gridKey = 0;
+				NiPoint3 position;
+				double movingUntil = 0.0;
+			};
+
+			void Add(TESObjectREFR* ref);
+			void Remove(FormID id);
+			// False when the entry is gone and was removed
+			bool Refresh(std::uint32_t slot);
+			void Seed();
+
+			std::vector<Entry> entries;
+			std::unordered_map<FormID, std::uint32_t> slotById;
+			std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> grid;
+			std::vector<FormID> moving;
+			std::uint32_t refreshCursor = 0;
+			bool seeded = false;
+
+			std::atomic<std::uint64_t> queryCount = 0;
+			std::atomic<std::uint64_t> candidateCount = 0;
+			std::atomic<std::uint64_t> hitCount = 0;
+
+			mutable std::shared_mutex lock;
+	};
+}
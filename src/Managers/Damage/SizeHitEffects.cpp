@@ -1,4 +1,5 @@
 #include "Managers/Damage/SizeHitEffects.hpp"
+#include "Managers/Damage/DamageBuffer.hpp"
 
 #include "Managers/Animation/AnimationManager.hpp"
 #include "Managers/Animation/Grab.hpp"
@@ -272,7 +273,7 @@ namespace GTS {
 						}
 					}
 					if (damage > 0) {
-						InflictSizeDamage(giant, tiny, damage * 1.5f);
+						DamageBuffer::AddSizeDamage(giant, tiny, damage * 1.5f);
 					}
 				}
 			}
@@ -178,11 +178,11 @@ namespace GTS {
     }
 
     void TinyCalamity_SeekForShrink(Actor* giant, Actor* tiny, float damage, float maxFootDistance, DamageSource Cause, bool Right, bool ApplyCooldown, bool ignore_rotation) {
-        std::vector<NiPoint3> CoordsToCheck = GetFootCoordinates(giant, Right, ignore_rotation);
+        const FootPoints CoordsToCheck = ContactSnapshot::GetFootPoints(giant, Right, ignore_rotation);
         int nodeCollisions = 0;
         auto model = tiny->GetCurrent3D();
         if (model) {
-            for (auto &point : CoordsToCheck) {
+            for (const auto& point : CoordsToCheck) {
                 bool StopDamageLookup = false;
                 if (!StopDamageLookup) {
                     VisitNodes(model, [&nodeCollisions, point, maxFootDistance, &StopDamageLookup](NiAVObject& a_obj) {
@@ -0,0 +1,242 @@
+#include "Managers/EffectScheduler.hpp"
+#include "Managers/Console/ConsoleManager.hpp"
+
+namespace {
+
+	// More than this many distinct effects (after merging) in one frame and the rest is dropped
+	constexpr std::size_t MaxQueued = 256;
+	constexpr std::size_t MaxSpawnsPerFrame = 16;
+	constexpr std::size_t MaxSpawnsPerCell = 10;
+
+	// Same model effects closer than this (times the larger effect scale) become one effect
+	constexpr float MergeDistance = 20.0f;
+	// A merged effect grows with the effects it absorbs, but never past this multiple of the largest one
+	constexpr float MaxMergeGrowth = 1.5f;
+
+	constexpr float MinImportanceDistance = 64.0f;
+	constexpr float OffScreenWeight = 0.25f;
+	constexpr float PlayerWeight = 2.0f;
+
+	NiPoint3 GetCameraPosition() {
+		auto camera = PlayerCamera::GetSingleton();
+		if (camera && camera->cameraRoot) {
+			return camera->cameraRoot->world.translate;
+		}
+		auto player = PlayerCharacter::GetSingleton();
+		return player ? player->GetPosition() : NiPoint3();
+	}
+
+	bool IsOnScreen(const NiPoint3& a_position) {
+		float x = 0.0f;
+		float y = 0.0f;
+		float z = 0.0f;
+		if (!NiCamera::WorldPtToScreenPt3(GTS::World::WorldToCamera().data, GTS::World::ViewPort(), a_position, x, y, z, 1e-5f)) {
+			return false;
+		}
+		return x >= 0.0f && x <= 1.0f && y >= 0.0f && y <= 1.0f;
+	}
+
+	void CMD_EffectStats() {
+		GTS::EffectScheduler::PrintStats();
+	}
+}
+
+namespace GTS {
+
+	EffectScheduler& EffectScheduler::GetSingleton() noexcept {
+		static EffectScheduler instance;
+		return instance;
+	}
+
+	std::string EffectScheduler::DebugName() {
+		return "::EffectScheduler";
+	}
+
+	void EffectScheduler::DataReady() {
+		ConsoleManager::RegisterCommand("effectstats", CMD_EffectStats, "Print how many particles and explosions were merged, dropped and spawned");
+	}
+
+	void EffectScheduler::Update() {
+		if (this->queued.empty()) {
+			return;
+		}
+		GTS_PROFILE_SCOPE("EffectScheduler: Flush");
+		this->Flush();
+	}
+
+	void EffectScheduler::Reset() {
+		this->queued.clear();
+		this->frameRequests = 0;
+	}
+
+	bool EffectScheduler::QueueParticle(Actor* source, float lifetime, const char* modelName, const NiMatrix3& rotation, const NiPoint3& position, float scale, std::uint32_t flags, NiAVObject* target) {
+		// Attached particles follow their node, there's nothing to merge
+		if (!source || !modelName || !*modelName || target || !OnMainUpdateThread()) {
+			return false;
+		}
+		auto cell = source->GetParentCell();
+		if (!cell) {
+			return false;
+		}
+		GetSingleton().Enqueue(Request {
+			.source = source->CreateRefHandle(),
+			.cell = cell,
+			.model = modelName,
+			.rotation = rotation,
+			.position = position,
+			.scale = scale,
+			.lifetime = lifetime,
+			.flags = flags,
+			.fromPlayer = source->formID == 0x14,
+		});
+		return true;
+	}
+
+	bool EffectScheduler::QueueExplosion(Actor* source, BGSExplosion* explosion, const NiPoint3& position, float radiusScale, bool still) {
+		if (!source || !explosion || !OnMainUpdateThread()) {
+			return false;
+		}
+		GetSingleton().Enqueue(Request {
+			.source = source->CreateRefHandle(),
+			.cell = source->GetParentCell(),
+			.explosion = explosion,
+			.position = position,
+			.scale = radiusScale,
+			.still = still,
+			.fromPlayer = source->formID == 0x14,
+		});
+		return true;
+	}
+
+	void EffectScheduler::PrintStats() {
+		auto& me = GetSingleton();
+		Cprint("--- Effect Scheduler ---");
+		Cprint("Requested: {}", me.requestedCount);
+		Cprint("Merged: {}", me.mergedCount);
+		Cprint("Dropped by budget: {}", me.droppedCount);
+		Cprint("Spawned: {}", me.spawnedCount);
+		Cprint("Peak requests in one frame: {}", me.peakPerFrame);
+		me.requestedCount = 0;
+		me.mergedCount = 0;
+		me.droppedCount = 0;
+		me.spawnedCount = 0;
+		me.peakPerFrame = 0;
+	}
+
+	bool EffectScheduler::CanMerge(const Request& a_lhs, const Request& a_rhs) {
+		if (a_lhs.cell != a_rhs.cell || a_lhs.explosion != a_rhs.explosion || a_lhs.still != a_rhs.still) {
+			return false;
+		}
+		if (!a_lhs.model.empty()) {
+			if (a_lhs.model != a_rhs.model) {
+				return false;
+			}
+			if (a_lhs.flags != a_rhs.flags || std::fabs(a_lhs.lifetime - a_rhs.lifetime) > 0.01f) {
+				return false;
+			}
+			if (std::memcmp(&a_lhs.rotation, &a_rhs.rotation, sizeof(NiMatrix3)) != 0) {
+				return false;
+			}
+		}
+		else if (!a_rhs.model.empty()) {
+			return false;
+		}
+		const float distance = MergeDistance * std::max(a_lhs.scale, a_rhs.scale);
+		return (a_lhs.position - a_rhs.position).SqrLength() <= distance * distance;
+	}
+
+	void EffectScheduler::Merge(Request& a_into, const Request& a_from) {
+		const float total = a_into.scale + a_from.scale;
+		if (total > 0.0f) {
+			a_into.position = (a_into.position * a_into.scale + a_from.position * a_from.scale) / total;
+		}
+		// Combine as areas so two equal effects read as one a bit larger, not twice as big
+		const float largest = std::max(a_into.scale, a_from.scale);
+		const float combined = std::sqrt(a_into.scale * a_into.scale + a_from.scale * a_from.scale);
+		a_into.scale = std::min(combined, largest * MaxMergeGrowth);
+		a_into.fromPlayer = a_into.fromPlayer || a_from.fromPlayer;
+	}
+
+	void EffectScheduler::Enqueue(Request&& a_request) {
+		this->requestedCount += 1;
+		this->frameRequests += 1;
+		// Merged as they come in, so a burst of the same effect takes one slot instead of filling the queue
+		for (auto& existing : this->queued) {
+			if (CanMerge(existing, a_request)) {
+				Merge(existing, a_request);
+				this->mergedCount += 1;
+				return;
+			}
+		}
+		if (this->queued.size() >= MaxQueued) {
+			this->droppedCount += 1;
+			return;
+		}
+		this->queued.push_back(std::move(a_request));
+	}
+
+	void EffectScheduler::Spawn(const Request& a_request) {
+		if (!a_request.model.empty()) {
+			BSTempEffectParticle::Spawn(a_request.cell, a_request.lifetime, a_request.model.c_str(), a_request.rotation, a_request.position, a_request.scale, a_request.flags, nullptr);
+			return;
+		}
+
+		auto source = a_request.source.get();
+		if (!source) {
+			return;
+		}
+		NiPointer<TESObjectREFR> instance_ptr = source->PlaceObjectAtMe(a_request.explosion, false);
+		if (!instance_ptr) {
+			return;
+		}
+		Explosion* explosion = instance_ptr->AsExplosion();
+		if (!explosion) {
+			return;
+		}
+		explosion->SetPosition(a_request.position);
+		explosion->GetExplosionRuntimeData().radius *= a_request.scale;
+		explosion->GetExplosionRuntimeData().imodRadius *= a_request.scale;
+		if (a_request.still) {
+			explosion->GetExplosionRuntimeData().unkB8 = nullptr;
+			explosion->GetExplosionRuntimeData().negativeVelocity *= 0.0f;
+			explosion->GetExplosionRuntimeData().unk11C *= 0.0f;
+		}
+	}
+
+	void EffectScheduler::Flush() {
+		this->peakPerFrame = std::max(this->peakPerFrame, this->frameRequests);
+		this->frameRequests = 0;
+
+		const NiPoint3 camera = GetCameraPosition();
+		for (auto& request : this->queued) {
+			float importance = request.scale / std::max((request.position - camera).Length(), MinImportanceDistance);
+			if (!IsOnScreen(request.position)) {
+				importance *= OffScreenWeight;
+			}
+			if (request.fromPlayer) {
+				importance *= PlayerWeight;
+			}
+			request.importance = importance;
+		}
+		std::ranges::sort(this->queued, std::ranges::greater{}, &Request::importance);
+
+		// Usually just one or two cells are involved
+		std::vector<std::pair<TESObjectCELL*, std::size_t>> perCell;
+		std::size_t spawned = 0;
+		for (const auto& request : this->queued) {
+			auto cell = std::ranges::find(perCell, request.cell, &std::pair<TESObjectCELL*, std::size_t>::first);
+			if (cell == perCell.end()) {
+				cell = perCell.emplace(perCell.end(), request.cell, 0);
+			}
+			if (spawned >= MaxSpawnsPerFrame || cell->second >= MaxSpawnsPerCell) {
+				this->droppedCount += 1;
+				continue;
+			}
+			Spawn(request);
+			cell->second += 1;
+			spawned += 1;
+		}
+		this->spawnedCount += spawned;
+		this->queued.clear();
+	}
+}
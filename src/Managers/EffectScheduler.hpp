@@ -0,0 +1,63 @@
+#pragma once
+
+// Collects particle and explosion requests made during a frame and spawns them in one go
+//
+// A stomp on a crowd used to spawn dozens of identical dust and blood effects in the same frame.
+// Requests for the same model/explosion close to each other are merged into one bigger effect and
+// the rest is spawned by screen importance under a per-frame and per-cell budget.
+
+namespace GTS {
+
+	class EffectScheduler : public EventListener {
+		public:
+			[[nodiscard]] static EffectScheduler& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void DataReady() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+
+			// Both return false when the request can't be deferred (off the main thread, attached to a node or
+			// the source has no cell) and the caller should spawn it right away
+			static bool QueueParticle(Actor* source, float lifetime, const char* modelName, const NiMatrix3& rotation, const NiPoint3& position, float scale, std::uint32_t flags, NiAVObject* target);
+			// still also zeroes the explosion's push and light, used by dust clouds
+			static bool QueueExplosion(Actor* source, BGSExplosion* explosion, const NiPoint3& position, float radiusScale, bool still);
+
+			static void PrintStats();
+
+		private:
+			struct Request {
+				ActorHandle source;
+				TESObjectCELL* cell = nullptr;
+				// Particle when model is set, explosion otherwise. Copied, the caller's string may be a temporary
+				std::string model;
+				BGSExplosion* explosion = nullptr;
+				NiMatrix3 rotation;
+				NiPoint3 position;
+				float scale = 1.0f;
+				float lifetime = 0.0f;
+				std::uint32_t flags = 0;
+				bool still = false;
+				bool fromPlayer = false;
+				float importance = 0.0f;
+			};
+
+			static bool CanMerge(const Request& a_lhs, const Request& a_rhs);
+			static void Merge(Request& a_into, const Request& a_from);
+			static void Spawn(const Request& a_request);
+
+			// Merges into a queued request when one is close enough, drops it when the queue is full
+			void Enqueue(Request&& a_request);
+			void Flush();
+
+			// Already merged, one entry per effect to spawn
+			std::vector<Request> queued;
+			std::size_t frameRequests = 0;
+
+			std::uint64_t requestedCount = 0;
+			std::uint64_t mergedCount = 0;
+			std::uint64_t droppedCount = 0;
+			std::uint64_t spawnedCount = 0;
+			std::size_t peakPerFrame = 0;
+	};
+}
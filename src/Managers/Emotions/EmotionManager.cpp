@@ -34,114 +34,28 @@ namespace {
 		data->modifierKeyFrame.SetValue(Modifier, Value);
 	}
 
-	void Task_UpdatePhenome(Actor* giant, int phenome, float mfg_speed, float target) {
-		
-		if (!EmotionManager::IsEmotionBusy(giant, CharEmotionType::Phenome)) {
-			std::string name = std::format("Phenome_{}_{}_{}_{}", giant->formID, phenome, target, Time::WorldTimeElapsed());
-			ActorHandle giantHandle = giant->CreateRefHandle();
-			double start = Time::WorldTimeElapsed();
-
-			float InitialValue = EmotionManager::GetEmotionValue(giant, CharEmotionType::Phenome, phenome);
-			bool revert = target <= 0.0f;
-
-			TaskManager::Run(name, [=](auto& progressData) {
-				if (!giantHandle) {
-					return false;
-				}
-
-				auto giantref = giantHandle.get().get();
-				double pass = Time::WorldTimeElapsed() - start;
-
-				if (!giantref->Is3DLoaded()) {
-					return false;
-				}
-
-				float AnimSpeed = AnimationManager::GetSingleton().GetAnimSpeed(giant);
-				float speed = 1.25f * AnimSpeed * mfg_speed * Speed_up;
-				//log::info("Running Facial Task: {}", name);
-				float value = static_cast<float>(pass * speed);
-				auto FaceData = GetFacialData(giantref);
-
-				bool ShouldFinish = target > 0.0f && value >= target;
-
-				if (FaceData) {
-					if (ShouldFinish) { // fully applied
-						Phenome_ManagePhenomes(FaceData, phenome, target);
-						EmotionManager::SetEmotionBusy(giantref, CharEmotionType::Phenome, false);
-						return false;
-					} 
-
-					if (revert) {
-						Phenome_ManagePhenomes(FaceData, phenome, InitialValue - value);
-						if (InitialValue - value <= 0.0f) {
-							Phenome_ManagePhenomes(FaceData, phenome, 0.0f); // Finish Task
-							EmotionManager::SetEmotionBusy(giantref, CharEmotionType::Phenome, false);
-							return false;
-						}
-					} else {
-						Phenome_ManagePhenomes(FaceData, phenome, value);
-					}
-					
-					return true;
-				}
-				EmotionManager::SetEmotionBusy(giantref, CharEmotionType::Phenome, false);
-				return false;
-			});
-		}
-	}
-
-	void Task_UpdateModifier(Actor* giant, int modifier, float mfg_speed, float target) {
-		if (!EmotionManager::IsEmotionBusy(giant, CharEmotionType::Modifier)) {
-			std::string name = std::format("Modifier_{}_{}_{}", giant->formID, modifier, target);
-			ActorHandle giantHandle = giant->CreateRefHandle();
-			double start = Time::WorldTimeElapsed();
-
-			float InitialValue = EmotionManager::GetEmotionValue(giant, CharEmotionType::Modifier, modifier);
-			bool revert = target <= 0.0f;
-
-			TaskManager::Run(name, [=](auto& progressData) {
-				if (!giantHandle) {
-					return false;
-				}
-
-				auto giantref = giantHandle.get().get();
-				double pass = Time::WorldTimeElapsed() - start;
-
-				if (!giantref->Is3DLoaded()) {
-					return false;
-				}
-
-				float AnimSpeed = AnimationManager::GetSingleton().GetAnimSpeed(giant);
-				float speed = 1.0f * AnimSpeed * mfg_speed * Speed_up;
-
-				float value = static_cast<float>(pass * speed);
-				auto FaceData = GetFacialData(giantref);
-
-				bool ShouldFinish = target > 0.0f && value >= target;
-				//log::info("Running Facial Task: {}", name);
-				if (FaceData) {
-					if (ShouldFinish) { // fully applied
-						Phenome_ManageModifiers(FaceData, modifier, target);
-						EmotionManager::SetEmotionBusy(giantref, CharEmotionType::Modifier, false);
-						return false;
-					} 
-
-					if (revert) {
-						Phenome_ManageModifiers(FaceData, modifier, InitialValue - value);
-						if (InitialValue - value <= 0.0f) {
-							Phenome_ManageModifiers(FaceData, modifier, 0.0f); // Finish Task
-							EmotionManager::SetEmotionBusy(giantref, CharEmotionType::Modifier, false);
-							return false;
-						}
-					} else {
-						Phenome_ManageModifiers(FaceData, modifier, value);
-					}
-
-					return true;
-				}
-				EmotionManager::SetEmotionBusy(giantref, CharEmotionType::Modifier, false);
-				return false;
-			});
+	constexpr std::uint32_t PhenomeCount = 16;
+	constexpr std::uint32_t ModifierCount = 14;
+
+	float Ease(FacialCurve curve, float t) {
+		switch (curve) {
+			case FacialCurve::EaseIn:
+				return t * t;
+			case FacialCurve::EaseOut:
+				return 1.0f - (1.0f - t) * (1.0f - t);
+			case FacialCurve::EaseInOut:
+				return t * t * (3.0f - 2.0f * t);
+			default:
+				return t;
+		}
+	}
+
+	void SetMorph(BSFaceGenAnimationData* data, CharEmotionType Type, std::uint32_t morph, float value) {
+		if (Type == CharEmotionType::Phenome) {
+			Phenome_ManagePhenomes(data, morph, value);
+		}
+		else {
+			Phenome_ManageModifiers(data, morph, value);
 		}
 	}
 }
@@ -203,11 +117,127 @@ namespace GTS {
 		return value;
 	}
 
-	void EmotionManager::OverridePhenome(Actor* giant, int number, float mfg_speed, float target) {
-		Task_UpdatePhenome(giant, number, mfg_speed, target);
+	void EmotionManager::OverridePhenome(Actor* giant, int number, float mfg_speed, float target, FacialCurve curve) {
+		if (!IsEmotionBusy(giant, CharEmotionType::Phenome)) {
+			this->Animate(giant, CharEmotionType::Phenome, number, 1.25f * mfg_speed * Speed_up, target, curve);
+		}
+	}
+
+	void EmotionManager::OverrideModifier(Actor* giant, int number, float mfg_speed, float target, FacialCurve curve) {
+		if (!IsEmotionBusy(giant, CharEmotionType::Modifier)) {
+			this->Animate(giant, CharEmotionType::Modifier, number, 1.0f * mfg_speed * Speed_up, target, curve);
+		}
+	}
+
+	void EmotionManager::Animate(Actor* giant, CharEmotionType type, int morph, float rate, float target, FacialCurve curve) {
+		if (!giant || morph < 0) {
+			return;
+		}
+		const std::uint32_t limit = type == CharEmotionType::Phenome ? PhenomeCount : ModifierCount;
+		if (static_cast<std::uint32_t>(morph) >= limit) {
+			return;
+		}
+
+		auto [found, inserted] = this->animators.try_emplace(giant->formID);
+		auto& animator = found->second;
+		if (inserted || animator.actor.get().get() != giant) {
+			animator = FaceAnimator();
+			animator.actor = giant->CreateRefHandle();
+			animator.lastTime = Time::WorldTimeElapsed();
+		}
+
+		FacialTrack* track = nullptr;
+		for (std::uint8_t i = 0; i < animator.count; i++) {
+			if (animator.tracks[i].type == type && animator.tracks[i].morph == morph) {
+				track = &animator.tracks[i];
+				break;
+			}
+		}
+		if (!track) {
+			track = &animator.tracks[animator.count];
+			animator.count += 1;
+		}
+
+		// Blend on from wherever the morph is right now, even when it was mid way to another target
+		track->type = type;
+		track->morph = static_cast<std::uint8_t>(morph);
+		track->curve = curve;
+		track->from = GetEmotionValue(giant, type, morph);
+		track->to = std::max(target, 0.0f);
+		track->rate = rate;
+		track->progress = 0.0f;
+		// Rising morphs used to start at 0 and reverting ones ran down from where they were
+		track->duration = rate > 0.0f ? (track->to > 0.0f ? track->to : track->from) / rate : 0.0f;
+		track->elapsed = 0.0f;
+	}
+
+	bool EmotionManager::Advance(FaceAnimator& animator, double now) {
+		auto giant = animator.actor.get().get();
+		if (!giant) {
+			return false;
+		}
+		auto FaceData = giant->Is3DLoaded() ? GetFacialData(giant) : nullptr;
+		if (!FaceData) {
+			SetEmotionBusy(giant, CharEmotionType::Phenome, false);
+			SetEmotionBusy(giant, CharEmotionType::Modifier, false);
+			return false;
+		}
+
+		const float delta = static_cast<float>(now - animator.lastTime) * AnimationManager::GetAnimSpeed(giant);
+		animator.lastTime = now;
+
+		bool phenomeFinished = false;
+		bool modifierFinished = false;
+		std::uint8_t i = 0;
+		while (i < animator.count) {
+			auto& track = animator.tracks[i];
+			const float distance = std::abs(track.to - track.from);
+			track.progress = distance > 1e-4f ? std::min(track.progress + delta * track.rate / distance, 1.0f) : 1.0f;
+			track.elapsed += delta;
+			SetMorph(FaceData, track.type, track.morph, std::lerp(track.from, track.to, Ease(track.curve, track.progress)));
+
+			if (track.progress >= 1.0f && track.elapsed >= track.duration) {
+				(track.type == CharEmotionType::Phenome ? phenomeFinished : modifierFinished) = true;
+				animator.count -= 1;
+				track = animator.tracks[animator.count];
+				continue;
+			}
+			i++;
+		}
+
+		// Same as the old per morph tasks, finished morphs let new requests of their kind through again,
+		// but only once every morph of that kind is done
+		bool phenomeRunning = false;
+		bool modifierRunning = false;
+		for (std::uint8_t t = 0; t < animator.count; t++) {
+			(animator.tracks[t].type == CharEmotionType::Phenome ? phenomeRunning : modifierRunning) = true;
+		}
+		if (phenomeFinished && !phenomeRunning) {
+			SetEmotionBusy(giant, CharEmotionType::Phenome, false);
+		}
+		if (modifierFinished && !modifierRunning) {
+			SetEmotionBusy(giant, CharEmotionType::Modifier, false);
+		}
+		return animator.count > 0;
+	}
+
+	void EmotionManager::Update() {
+		if (this->animators.empty()) {
+			return;
+		}
+		const double now = Time::WorldTimeElapsed();
+		std::erase_if(this->animators, [now](auto& entry) {
+			return !Advance(entry.second, now);
+		});
 	}
 
-	void EmotionManager::OverrideModifier(Actor* giant, int number, float mfg_speed, float target) {
-		Task_UpdateModifier(giant, number, mfg_speed, target);
+	void EmotionManager::Reset() {
+		this->animators.clear();
 	}
-}
\ No newline at end of file
+
+	void EmotionManager::ResetActor(Actor* actor) {
+		if (actor) {
+			this->animators.erase(actor->formID);
+		}
+	}
+}
@@ -1,20 +1,67 @@
 #pragma once
 
-// Module that handles AttributeAdjustment
+// Drives phoneme and modifier morphs of actor faces
+//
+// Every actor with a moving face gets one animator that holds a track per morph in a fixed array.
+// All tracks of an actor advance together once per frame, a new target for a morph that is still moving
+// blends on from where the morph currently is instead of starting a second animation.
 
 namespace GTS {
+
+	enum class FacialCurve : std::uint8_t {
+		Linear,
+		EaseIn,
+		EaseOut,
+		EaseInOut,
+	};
+
 	class EmotionManager : public EventListener {
 		public:
 			[[nodiscard]] static EmotionManager& GetSingleton() noexcept;
-			
 
 			virtual std::string DebugName() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+			virtual void ResetActor(Actor* actor) override;
 
 			static void SetEmotionBusy(Actor* giant, CharEmotionType Type, bool lock);
 			static bool IsEmotionBusy(Actor* giant, CharEmotionType Type);
 
 			static float GetEmotionValue(Actor* giant, CharEmotionType Type, std::uint32_t emotion_value);
-			void OverridePhenome(Actor* giant, int number, float mfg_speed, float target);
-			void OverrideModifier(Actor* giant, int number, float mfg_speed, float target);
+			void OverridePhenome(Actor* giant, int number, float mfg_speed, float target, FacialCurve curve = FacialCurve::Linear);
+			void OverrideModifier(Actor* giant, int number, float mfg_speed, float target, FacialCurve curve = FacialCurve::Linear);
+
+		private:
+			struct FacialTrack {
+				CharEmotionType type = CharEmotionType::Phenome;
+				std::uint8_t morph = 0;
+				FacialCurve curve = FacialCurve::Linear;
+				float from = 0.0f;
+				float to = 0.0f;
+				// Morph units per second before anim speed
+				float rate = 0.0f;
+				// 0..1 along from -> to
+				float progress = 0.0f;
+				// The track holds its kind busy at least this long, the time the caller's speed asked for
+				// even when the morph already sits at its target
+				float duration = 0.0f;
+				float elapsed = 0.0f;
+			};
+
+			// 16 phonemes + 14 modifiers, one track per morph so this can never run out
+			static constexpr std::size_t MaxTracks = 32;
+
+			struct FaceAnimator {
+				ActorHandle actor;
+				std::array<FacialTrack, MaxTracks> tracks = {};
+				std::uint8_t count = 0;
+				double lastTime = 0.0;
+			};
+
+			void Animate(Actor* giant, CharEmotionType type, int morph, float rate, float target, FacialCurve curve);
+			// False once the animator has nothing left to do
+			static bool Advance(FaceAnimator& animator, double now);
+
+			std::unordered_map<FormID, FaceAnimator> animators;
 	};
 }
@@ -0,0 +1,135 @@
+#include "Managers/FinisherTable.hpp"
+
+namespace GTS {
+
+	bool FinisherTable::Start(Actor* giant, Actor* tiny) {
+		if (!giant || !tiny || this->Contains(tiny->formID)) {
+			return false;
+		}
+
+		std::uint32_t index = 0;
+		if (!this->freeSlots.empty()) {
+			index = this->freeSlots.back();
+			this->freeSlots.pop_back();
+		}
+		else {
+			index = static_cast<std::uint32_t>(this->slots.size());
+			this->slots.emplace_back();
+		}
+
+		auto& slot = this->slots[index];
+		slot.giant = giant->CreateRefHandle();
+		slot.tiny = tiny->CreateRefHandle();
+		slot.tinyId = tiny->formID;
+		slot.stage = FinisherStage::Start;
+		slot.delay.Reset();
+
+		const SlotRef ref { .index = index, .generation = slot.generation };
+		this->running.emplace(tiny->formID, ref);
+		this->pending.push_back(ref);
+		return true;
+	}
+
+	bool FinisherTable::Contains(FormID tinyId) const {
+		return this->running.contains(tinyId) || this->finished.contains(tinyId);
+	}
+
+	void FinisherTable::Erase(FormID tinyId) {
+		this->finished.erase(tinyId);
+		auto found = this->running.find(tinyId);
+		if (found != this->running.end()) {
+			// The pending queue entry is skipped by the generation check
+			this->Release(found->second.index);
+			this->running.erase(found);
+		}
+	}
+
+	void FinisherTable::Clear() {
+		this->slots.clear();
+		this->freeSlots.clear();
+		this->running.clear();
+		this->pending.clear();
+		this->finished.clear();
+	}
+
+	FinisherTable::Slot* FinisherTable::Resolve(const SlotRef& ref) {
+		if (ref.index >= this->slots.size()) {
+			return nullptr;
+		}
+		auto& slot = this->slots[ref.index];
+		return slot.generation == ref.generation ? &slot : nullptr;
+	}
+
+	void FinisherTable::Release(std::uint32_t index) {
+		auto& slot = this->slots[index];
+		slot.generation += 1;
+		slot.giant = ActorHandle();
+		slot.tiny = ActorHandle();
+		slot.tinyId = 0;
+		this->freeSlots.push_back(index);
+	}
+
+	void FinisherTable::Advance(const StepFunction& step) {
+		if (this->pending.empty()) {
+			return;
+		}
+
+		// Finishers started from inside step land in pending and run next update
+		this->nextPending.clear();
+		this->nextPending.swap(this->pending);
+
+		for (const auto& ref : this->nextPending) {
+			// Step may start new finishers and grow the slot table, so look the slot up again every time
+			if (!this->Resolve(ref)) {
+				continue;
+			}
+			auto giant = this->slots[ref.index].giant.get().get();
+			auto tiny = this->slots[ref.index].tiny.get().get();
+			const FormID tinyId = this->slots[ref.index].tinyId;
+			if (!giant || !tiny) {
+				this->Release(ref.index);
+				this->running.erase(tinyId);
+				continue;
+			}
+
+			const FinisherStep result = step(this->slots[ref.index], giant, tiny);
+
+			// Step may have reset the tiny
+			if (!this->Resolve(ref)) {
+				continue;
+			}
+			switch (result) {
+				case FinisherStep::Wait: {
+					this->pending.push_back(ref);
+					break;
+				}
+				case FinisherStep::Next: {
+					this->slots[ref.index].stage = FinisherStage::Finishing;
+					this->pending.push_back(ref);
+					break;
+				}
+				case FinisherStep::Done: {
+					this->finished.insert_or_assign(tinyId, this->slots[ref.index].tiny);
+					this->Release(ref.index);
+					this->running.erase(tinyId);
+					break;
+				}
+			}
+		}
+		this->nextPending.clear();
+	}
+
+	void FinisherTable::PruneFinished() {
+		this->prune(this->finished, [](const auto& entry) {
+			return !entry.second.get();
+		});
+	}
+
+	std::size_t FinisherTable::RunningCount() const {
+		return this->running.size();
+	}
+
+	std::size_t FinisherTable::FinishedCount() const {
+		return this->finished.size();
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+// Shared state table for the Crush, ShrinkToNothing and Overkill finishers
+//
+// Each manager used to keep every tiny it ever finished in an unordered_map and walk all of it every frame,
+// looking up long dead actors. Running finishers now live in a dense slot table driven by a pending queue,
+// finished ones only keep their form id and handle around so AlreadyCrushed & co still answer until the actor
+// is reset or the reference is deleted.
+
+namespace GTS {
+
+	enum class FinisherStage : std::uint8_t {
+		Start,     // Queued this frame, nothing done yet
+		Finishing, // Reanimated state set, waiting to be killed
+	};
+
+	enum class FinisherStep : std::uint8_t {
+		Wait, // Stay in the current stage, try again next update
+		Next, // Move to the next stage
+		Done, // Finished, retire the slot
+	};
+
+	class FinisherTable {
+		public:
+			struct Slot {
+				ActorHandle giant;
+				ActorHandle tiny;
+				FormID tinyId = 0;
+				std::uint32_t generation = 0;
+				FinisherStage stage = FinisherStage::Start;
+				Timer delay = Timer(0.01);
+			};
+
+			// slot is only valid until step starts another finisher
+			using StepFunction = std::function<FinisherStep(Slot& slot, Actor* giant, Actor* tiny)>;
+
+			// False when the tiny is already running or finished
+			bool Start(Actor* giant, Actor* tiny);
+			// Running or finished
+			[[nodiscard]] bool Contains(FormID tinyId) const;
+			void Erase(FormID tinyId);
+			void Clear();
+
+			// Runs step for every running finisher, slots whose giant or tiny is gone are dropped
+			void Advance(const StepFunction& step);
+			// Forgets finished tinies whose reference was deleted, call every update
+			void PruneFinished();
+
+			[[nodiscard]] std::size_t RunningCount() const;
+			[[nodiscard]] std::size_t FinishedCount() const;
+
+		private:
+			struct SlotRef {
+				std::uint32_t index = 0;
+				std::uint32_t generation = 0;
+			};
+
+			Slot* Resolve(const SlotRef& ref);
+			void Release(std::uint32_t index);
+
+			std::vector<Slot> slots;
+			std::vector<std::uint32_t> freeSlots;
+			std::unordered_map<FormID, SlotRef> running;
+			std::vector<SlotRef> pending;
+			std::vector<SlotRef> nextPending;
+			// Unloaded references still resolve by form id, the handle is what goes away with the reference
+			std::unordered_map<FormID, ActorHandle> finished;
+			PeriodicPrune prune;
+	};
+}
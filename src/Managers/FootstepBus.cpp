@@ -0,0 +1,118 @@
+#include "Managers/FootstepBus.hpp"
+#include "Managers/ModEvent.hpp"
+
+namespace {
+
+	bool Matches(const GTS::FootstepFilter& filter, bool player, bool follower, float scale) {
+		if (scale < filter.minScale) {
+			return false;
+		}
+		switch (filter.actors) {
+			case GTS::FootstepActors::Player:
+				return player;
+			case GTS::FootstepActors::Followers:
+				return follower;
+			case GTS::FootstepActors::Others:
+				return !follower;
+			default:
+				return true;
+		}
+	}
+}
+
+namespace GTS {
+
+	FootstepBus& FootstepBus::GetSingleton() noexcept {
+		static FootstepBus instance;
+		return instance;
+	}
+
+	std::string FootstepBus::DebugName() {
+		return "::FootstepBus";
+	}
+
+	void FootstepBus::Subscribe(const FootstepFilter& filter, Callback callback) {
+		auto& me = GetSingleton();
+		if (filter.actors == FootstepActors::Followers || filter.actors == FootstepActors::Others) {
+			me.needsTeammate = true;
+		}
+		me.subscribers.emplace_back(filter, std::move(callback));
+	}
+
+	void FootstepBus::OnPapyrusRegister(bool registered) {
+		auto& me = GetSingleton();
+		if (registered) {
+			me.papyrusRegistrants.fetch_add(1, std::memory_order_relaxed);
+		}
+		else if (me.papyrusRegistrants.fetch_sub(1, std::memory_order_relaxed) <= 0) {
+			me.papyrusRegistrants.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	void FootstepBus::Publish(Actor* actor, const BSFixedString& tag, FootEvent kind) {
+		GTS_PROFILE_SCOPE("FootstepBus: Publish");
+		if (!actor) {
+			return;
+		}
+		auto& me = GetSingleton();
+
+		if (me.papyrusRegistrants.load(std::memory_order_relaxed) > 0) {
+			me.QueuePapyrus(actor, tag);
+		}
+
+		if (me.subscribers.empty()) {
+			return;
+		}
+
+		const FootstepEvent event {
+			.actor = actor,
+			.kind = kind,
+			.scale = get_visual_scale(actor),
+			.position = actor->GetPosition(),
+			.tag = std::string_view(tag.c_str(), tag.size()),
+		};
+		const bool player = actor->formID == 0x14;
+		const bool follower = player || (me.needsTeammate && IsTeammate(actor));
+
+		for (const auto& subscriber : me.subscribers) {
+			if (Matches(subscriber.filter, player, follower, event.scale)) {
+				subscriber.callback(event);
+			}
+		}
+	}
+
+	void FootstepBus::QueuePapyrus(Actor* actor, const BSFixedString& tag) {
+		std::unique_lock guard(this->pendingLock);
+		// BSFixedStrings are pooled, same text means same pointer
+		for (const auto& entry : this->pending) {
+			if (entry.actorId == actor->formID && entry.tag == tag) {
+				return;
+			}
+		}
+		this->pending.emplace_back(actor->CreateRefHandle(), actor->formID, tag);
+	}
+
+	void FootstepBus::Update() {
+		{
+			std::unique_lock guard(this->pendingLock);
+			if (this->pending.empty()) {
+				return;
+			}
+			this->sending.swap(this->pending);
+		}
+
+		GTS_PROFILE_SCOPE("FootstepBus: SendPapyrus");
+		auto& events = ModEventManager::GetSingleton();
+		for (const auto& entry : this->sending) {
+			if (auto actor = entry.actor.get().get()) {
+				events.m_onfootstep.SendEvent(actor, std::string(entry.tag.c_str()));
+			}
+		}
+		this->sending.clear();
+	}
+
+	void FootstepBus::Reset() {
+		std::unique_lock guard(this->pendingLock);
+		this->pending.clear();
+	}
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+// Footstep event bus
+//
+// Every footstep of every actor passes through here, so native subscribers get a small record that borrows the tag
+// from the engine event instead of copying it. Papyrus OnFootstep events are only queued while a script is registered,
+// and the same actor + tag is sent once per frame no matter how often the animation fired it.
+
+namespace GTS {
+
+	enum class FootstepActors : std::uint8_t {
+		Any,
+		Player,
+		Followers, // Player and teammates
+		Others,    // Everyone but the player and teammates
+	};
+
+	struct FootstepFilter {
+		FootstepActors actors = FootstepActors::Any;
+		float minScale = 0.0f;
+	};
+
+	// Only valid during the callback, tag points into the engine event
+	struct FootstepEvent {
+		Actor* actor = nullptr;
+		FootEvent kind = FootEvent::Unknown;
+		float scale = 1.0f;
+		NiPoint3 position;
+		std::string_view tag;
+	};
+
+	class FootstepBus : public EventListener {
+		public:
+			using Callback = std::function<void(const FootstepEvent& event)>;
+
+			[[nodiscard]] static FootstepBus& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+
+			// Subscribe while the plugin starts up, the subscriber list isn't locked
+			static void Subscribe(const FootstepFilter& filter, Callback callback);
+
+			// Called for every footstep event the engine sends, kind is Unknown for tags that are no footstep
+			static void Publish(Actor* actor, const BSFixedString& tag, FootEvent kind);
+
+			// Counts Papyrus registrations so nothing is queued while nobody listens
+			static void OnPapyrusRegister(bool registered);
+
+		private:
+			struct Subscriber {
+				FootstepFilter filter;
+				Callback callback;
+			};
+
+			struct PendingEvent {
+				ActorHandle actor;
+				FormID actorId = 0;
+				BSFixedString tag;
+			};
+
+			void QueuePapyrus(Actor* actor, const BSFixedString& tag);
+
+			std::vector<Subscriber> subscribers;
+			bool needsTeammate = false;
+
+			std::atomic<std::int32_t> papyrusRegistrants = 0;
+			std::mutex pendingLock;
+			std::vector<PendingEvent> pending;
+			std::vector<PendingEvent> sending;
+	};
+}
@@ -8,6 +8,7 @@
 #include "Managers/RipClothManager.hpp"
 #include "Managers/MaxSizeManager.hpp"
 #include "Managers/Animation/Grab.hpp"
+#include "Scale/SizeCache.hpp"
 
 #include "Magic/Effects/Common.hpp"
 #include "Utils/DynamicScale.hpp"
@@ -24,6 +25,20 @@ namespace {
 
 	const auto& GameplaySettings = Config::GetGameplay();
 
+	struct PendingScaleWrite {
+		Actor* actor;
+		TempActorData* trans_actor_data;
+		float visual_scale;
+		float game_scale;
+		float initial_scale;
+		float model_scale;
+	};
+
+	// Actors whose model scale has to change this frame, written together in FlushScaleWrites
+	std::vector<PendingScaleWrite> PendingScaleWrites;
+	// Actors apply_height didn't skip as settled since the last flush
+	uint32_t PendingScaleReads = 0;
+
 	constexpr float ini_adjustment = 65535.f; //High Value
 	constexpr float vanilla_interaction_range = 180.0f;
 	constexpr float vanilla_radius_range = 16.0f;
@@ -199,7 +214,10 @@ namespace {
 		}
 
 		const float currentOtherScale = Get_Other_Scale(actor);
-		trans_actor_data->OtherScales = currentOtherScale;
+		if (currentOtherScale != trans_actor_data->OtherScales) { // Racemenu or race scale changed
+			trans_actor_data->OtherScales = currentOtherScale;
+			trans_actor_data->ScaleDirty = true;
+		}
 
 		const float natural_scale = get_natural_scale(actor, false);
 		float target_scale = persi_actor_data->target_scale;
@@ -275,10 +293,6 @@ namespace {
 			log::info("!Height: Pers Data not found for {}", actor->GetDisplayFullName());
 			return;
 		}
-		float scale = get_scale(actor);
-		if (scale < 0.0f) {
-			return;
-		}
 		float visual_scale = persi_actor_data->visual_scale;
 
 		if(actor->formID == 0x14) {
@@ -287,19 +301,84 @@ namespace {
 			}
 		}
 
-		// Is scale correct already?
-		if (fabs(visual_scale - scale) <= 1e-5 && !force) {
+		// Settled: our own value didn't move, no write site marked the actor dirty, the SetScale value is the same
+		// and the 3D wasn't reloaded (console SetScale, race switch). Nothing is read from the model or the initial scales
+		const std::uint16_t refScale = actor->GetReferenceRuntimeData().refScale;
+		const NiAVObject* model = actor->Get3D(false);
+		if (!force &&
+			!trans_actor_data->ScaleDirty &&
+			visual_scale == trans_actor_data->AppliedVisualScale &&
+			refScale == trans_actor_data->AppliedRefScale &&
+			model == trans_actor_data->AppliedModel) {
 			return;
 		}
+
+		PendingScaleReads += 1;
+
+		float scale = get_scale(actor);
+		if (scale < 0.0f) {
+			return;
+		}
+
+		float GameScale = game_getactorscale(actor); // * by GetScale
+		float initialScale = GetInitialScale(actor); // Incorperate the NIF scale into our edits
+
+		// Something was marked dirty but the values we'd write are the ones we wrote last time
+		if (!force &&
+			visual_scale == trans_actor_data->AppliedVisualScale &&
+			GameScale == trans_actor_data->AppliedGameScale &&
+			initialScale == trans_actor_data->AppliedInitialScale &&
+			scale == trans_actor_data->AppliedModelScale) {
+			trans_actor_data->AppliedRefScale = refScale;
+			trans_actor_data->AppliedModel = model;
+			trans_actor_data->ScaleDirty = false;
+			return;
+		}
+
 		// Is scale too small
 		if (visual_scale <= 1e-5) {
 			return;
 		}
 
-		float initialScale = GetInitialScale(actor); // Incorperate the NIF scale into our edits
-		float GameScale = game_getactorscale(actor); // * by GetScale
-		
-		update_model_visuals(actor, visual_scale * initialScale * GameScale); // We've set the values, now update model size based on them
+		float model_scale = visual_scale * initialScale * GameScale;
+
+		// Is scale correct already?
+		if (fabs(model_scale - scale) <= 1e-5 && !force) {
+			trans_actor_data->AppliedVisualScale = visual_scale;
+			trans_actor_data->AppliedGameScale = GameScale;
+			trans_actor_data->AppliedInitialScale = initialScale;
+			trans_actor_data->AppliedModelScale = scale;
+			trans_actor_data->AppliedRefScale = refScale;
+			trans_actor_data->AppliedModel = model;
+			trans_actor_data->ScaleDirty = false;
+			return;
+		}
+
+		PendingScaleWrites.push_back({ actor, trans_actor_data, visual_scale, GameScale, initialScale, model_scale });
+	}
+
+	// Scale changed stage: only actors queued by apply_height get their model and dependent caches updated
+	void FlushScaleWrites() {
+		GTS_PROFILE_SCOPE("GTSManager: FlushScaleWrites");
+
+		GtsManager::ScaleWritesLastFrame = static_cast<uint32_t>(PendingScaleWrites.size());
+		GtsManager::ScaleReadsLastFrame = PendingScaleReads;
+		PendingScaleReads = 0;
+
+		for (const auto& write : PendingScaleWrites) {
+			update_model_visuals(write.actor, write.model_scale); // We've set the values, now update model size based on them
+
+			write.trans_actor_data->AppliedVisualScale = write.visual_scale;
+			write.trans_actor_data->AppliedGameScale = write.game_scale;
+			write.trans_actor_data->AppliedInitialScale = write.initial_scale;
+			write.trans_actor_data->AppliedModelScale = get_scale(write.actor);
+			write.trans_actor_data->AppliedRefScale = write.actor->GetReferenceRuntimeData().refScale;
+			write.trans_actor_data->AppliedModel = write.actor->Get3D(false);
+			write.trans_actor_data->ScaleDirty = false; // Our own write above marked it
+
+			SizeCache::Invalidate(write.actor);
+		}
+		PendingScaleWrites.clear();
 	}
 
 	void apply_speed(Actor* actor, ActorData* persi_actor_data, TempActorData* trans_actor_data, bool force = false) {
@@ -348,6 +427,7 @@ namespace {
 		auto temp_data = Transient::GetSingleton().GetActorData(actor);
 		auto saved_data = Persistent::GetSingleton().GetActorData(actor);
 		update_height(actor, saved_data, temp_data);
+		SizeCache::Invalidate(actor);
 	}
 
 	void apply_actor(Actor* actor, bool force = false) {
@@ -432,6 +512,8 @@ void GtsManager::Update() {
 			apply_actor(actor);
 		}
 	}
+
+	FlushScaleWrites();
 }
 
 void GtsManager::DragonSoulAbsorption() {
@@ -446,10 +528,11 @@ void GtsManager::reapply(bool force) {
 	for (auto actor: find_actors()) {
 		if (actor) {
 		   	if (actor->Is3DLoaded()) {
-				reapply_actor(actor, force);
+				apply_actor(actor, force);
 			}
 		}
 	}
+	FlushScaleWrites();
 }
 void GtsManager::reapply_actor(Actor* actor, bool force) {
 
@@ -459,6 +542,7 @@ void GtsManager::reapply_actor(Actor* actor, bool force) {
 	if (actor) {
 		if (actor->Is3DLoaded()) {
 			apply_actor(actor, force);
+			FlushScaleWrites();
 		}
 	}
 }
\ No newline at end of file
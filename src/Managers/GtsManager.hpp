@@ -16,6 +16,10 @@ namespace GTS {
 
 			//Used for profiling
 			static inline uint32_t LoadedActorCount = 0;
+			// Actors whose model scale was actually written last frame
+			static inline uint32_t ScaleWritesLastFrame = 0;
+			// Actors that weren't settled and had their model scales read last frame
+			static inline uint32_t ScaleReadsLastFrame = 0;
 
 			virtual void DragonSoulAbsorption() override;
 
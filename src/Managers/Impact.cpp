@@ -4,7 +4,7 @@
 #include "Managers/Animation/Utils/AnimationUtils.hpp"
 
 #include "Managers/GtsSizeManager.hpp"
-#include "Managers/ModEvent.hpp"
+#include "Managers/FootstepBus.hpp"
 
 #include "Config/Config.hpp"
 
@@ -34,7 +34,7 @@ namespace {
 		return true;
 	}
 
-	FootEvent get_foot_kind(Actor* actor, std::string_view tag) {
+	FootEvent get_foot_kind(Actor* actor, const BSFixedString& tag) {
 		GTS_PROFILE_SCOPE("Impact: GetFootKind");
 		
 
@@ -48,38 +48,33 @@ namespace {
 
 		bool isSprinting = actor->AsActorState()->IsSprinting();
 		bool allow = (!is_jumping || hugging);
-		
+
+		// Tags are classified once per unique string, no regex per event
+		const std::uint8_t tags = FootTagClassifier::Classify(tag);
+		const bool sprintTag = FootTagClassifier::Has(tags, FootTag::Sprint);
 
 		// Skip regular foot events if sprinting
-		if (matches(tag, ".*Foot.*Left.*") && allow) {
-			if (isSprinting) {
-				if (matches(tag, ".*Sprint.*")) {
-					foot_kind = FootEvent::Left;
-				}
-			} else {
+		if (FootTagClassifier::Has(tags, FootTag::FootLeft) && allow) {
+			if (!isSprinting || sprintTag) {
 				foot_kind = FootEvent::Left;
 			}
 		}
-		else if (matches(tag, ".*Foot.*Right.*") && allow) {
-			if (isSprinting) {
-				if (matches(tag, ".*Sprint.*")) {
-					foot_kind = FootEvent::Right;
-				}
-			} else {
+		else if (FootTagClassifier::Has(tags, FootTag::FootRight) && allow) {
+			if (!isSprinting || sprintTag) {
 				foot_kind = FootEvent::Right;
 			}
 		}
-		else if (!isSprinting && matches(tag, ".*Foot.*Front.*") && allow) {
+		else if (!isSprinting && FootTagClassifier::Has(tags, FootTag::FootFront) && allow) {
 			foot_kind = FootEvent::Front;
 		}
-		else if (!isSprinting && matches(tag, ".*Foot.*Back.*") && allow) {
+		else if (!isSprinting && FootTagClassifier::Has(tags, FootTag::FootBack) && allow) {
 			foot_kind = FootEvent::Back;
 		}
-		else if (matches(tag, ".*Jump.*(Down|Land).*") && !in_air) {
+		else if (FootTagClassifier::Has(tags, FootTag::JumpLand) && !in_air) {
 			foot_kind = FootEvent::JumpLand;
 		}
-    return foot_kind;
-}
+		return foot_kind;
+	}
 
 	std::vector<NiAVObject*> get_landing_nodes(Actor* actor, const FootEvent& foot_kind) {
 		GTS_PROFILE_SCOPE("Impact: GetLandingNodes");
@@ -235,24 +230,30 @@ namespace GTS {
 		if (a_event) {
 			GTS_PROFILE_SCOPE("Impact: HookProcessEvent");
 			auto actor = a_event->actor.get().get();
+			if (!actor) {
+				return;
+			}
 
 			auto id = a_event->pad04;
 			if (id != 10000001) { // .dll sends fake footstep events to fix missing foot sounds during some animations
 			    // If it matches that number = we don't want to do anything. Done inside FootStepManager::PlayVanillaFootstepSounds function
-				std::string tag = a_event->tag.c_str();
-				auto event_manager = ModEventManager::GetSingleton();
-				event_manager.m_onfootstep.SendEvent(actor,tag);
+				FootTagClassifier::Record(a_event->tag);
+				auto kind = get_foot_kind(actor, a_event->tag);
 
-				auto kind = get_foot_kind(actor, tag);
-
-				if (CanDoImpact(actor, kind)) { // Prevents earrape and effect spam from followers when they're large
-					float launch = 1.0f;
-					float radius = 1.0f;
-					
-					ApplyPerkBonuses(actor, launch, radius);
-					DoDamageAndLaunch(actor, kind, launch, radius); // Applies sounds as well
-				}	
+				FootstepBus::Publish(actor, a_event->tag, kind); // Impacts below, other native subscribers and Papyrus OnFootstep
 			}
 		}
 	}
+
+	void ImpactManager::SubscribeFootsteps() {
+		FootstepBus::Subscribe(FootstepFilter {}, [](const FootstepEvent& event) {
+			if (CanDoImpact(event.actor, event.kind)) { // Prevents earrape and effect spam from followers when they're large
+				float launch = 1.0f;
+				float radius = 1.0f;
+
+				ApplyPerkBonuses(event.actor, launch, radius);
+				DoDamageAndLaunch(event.actor, event.kind, launch, radius); // Applies sounds as well
+			}
+		});
+	}
 }
@@ -7,5 +7,8 @@ namespace GTS {
 			[[nodiscard]] static ImpactManager& GetSingleton() noexcept;
 
 		static void HookProcessEvent(BGSImpactManager* impact, const BGSFootstepEvent* a_event, BSTEventSource<BGSFootstepEvent>* a_eventSource);
+
+		// Puts the footstep explosions, sounds, damage and launches on the FootstepBus
+		static void SubscribeFootsteps();
 	};
 }
@@ -1,6 +1,31 @@
 #include "Managers/Input/InputManager.hpp"
 #include "Config/Keybinds.hpp"
 
+namespace {
+
+	// Maps a button to its bit in InputKeyMask, mouse buttons live after the keyboard scan codes
+	bool GetKeyIndex(const ButtonEvent* a_button, std::uint32_t& a_index) {
+		std::uint32_t key = a_button->GetIDCode();
+		switch (a_button->device.get()) {
+			case INPUT_DEVICE::kKeyboard: {
+				break;
+			}
+			case INPUT_DEVICE::kMouse: {
+				key += MOUSE_OFFSET;
+				break;
+			}
+			default: {
+				return false;
+			}
+		}
+		if (key >= GTS::InputKeyCount) {
+			return false;
+		}
+		a_index = key;
+		return true;
+	}
+}
+
 namespace GTS {
 
 	std::vector<ManagedInputEvent> InputManager::LoadInputEvents() {
@@ -51,6 +76,19 @@ namespace GTS {
 			return;
 		} 
 
+		m.TriggerEvents.clear();
+		m.TriggerEvents.reserve(m.ManagedTriggers.size());
+		for (const auto& trigger : m.ManagedTriggers) {
+			auto found = m.registedInputEvents.find(trigger.GetName());
+			if (found == m.registedInputEvents.end()) {
+				log::warn("Key binding {} has no event of that name", trigger.GetName());
+				m.TriggerEvents.push_back(nullptr);
+			} else {
+				m.TriggerEvents.push_back(&found->second);
+			}
+		}
+		m.firedTriggers.reserve(m.ManagedTriggers.size());
+
 		log::info("Loaded {} key bindings", m.ManagedTriggers.size());
 		
 		m.Ready.store(true);
@@ -58,8 +96,8 @@ namespace GTS {
 
 	void InputManager::ProcessEvents(InputEvent** a_event) {
 
-		std::unordered_set<uint32_t> KeysToBlock = {};
-		std::unordered_set<std::uint32_t> gameInputKeys = {};
+		InputKeyMask KeysToBlock = {};
+		InputKeyMask gameInputKeys = {};
 		RE::InputEvent* event = *a_event;
 		RE::InputEvent* prev = nullptr;
 
@@ -91,77 +129,60 @@ namespace GTS {
 			}
 
 			//If it is a ButtonEvent add it to to the list of pressed keys
-			if (buttonEvent->device.get() == INPUT_DEVICE::kKeyboard) {
-				auto key = buttonEvent->GetIDCode();
-				gameInputKeys.emplace(key);
-			}
-			else if (buttonEvent->device.get() == INPUT_DEVICE::kMouse) {
-				auto key = buttonEvent->GetIDCode();
-				gameInputKeys.emplace(key + MOUSE_OFFSET);
+			std::uint32_t key = 0;
+			if (GetKeyIndex(buttonEvent, key)) {
+				gameInputKeys.set(key);
 			}
 		}
 
-		for (auto& trigger : this->ManagedTriggers) {
+		for (std::size_t i = 0; i < this->ManagedTriggers.size(); ++i) {
+
+			auto& trigger = this->ManagedTriggers[i];
+			auto eventData = this->TriggerEvents[i];
 
-			if (trigger.IsDisabled()) continue;
+			// Nothing registered under this name, it can never fire
+			if (trigger.IsDisabled() || !eventData) continue;
 
 			// Store triggers in here that have been fired this frame
-			std::vector<ManagedInputEvent*> firedTriggers; 
+			this->firedTriggers.clear();
 			auto blockInput = trigger.ShouldBlock();
 
 			//Are all keys pressed for this trigger and are we allowed to selectively block?
 			//if never: behavior defaults to old implementation
 			if (trigger.AllKeysPressed(gameInputKeys)){
 				//log::debug("AllkeysPressed for trigger {}", trigger.GetName());
-				//Get the coresponding event data
-				try {
-					auto& eventData = this->registedInputEvents.at(trigger.GetName());
-
-					if (blockInput == BlockInputTypes::Always) {
-						//If force blocking is set block game input regardless of conditions
-						std::unordered_set<uint32_t> KeysToAdd = std::unordered_set<uint32_t>(trigger.GetKeys());
-						KeysToBlock.insert(KeysToAdd.begin(), KeysToAdd.end());
-
-						if (eventData.condition != nullptr) {
-							if (!eventData.condition()) {
-								continue;
-							}
-						}
 
-					}
-					//The condition callback can be null, check before calling it.
-					//In the case it's null input blocking or early continuing won't be done and the system will behave like previously unless its forced.
-					else if (eventData.condition != nullptr) {
-						//log::debug("condition exists {}", fmt::ptr(&eventData.condition));
-						//Used to verify wether this trigger will actually end up doing anthing
-						if (eventData.condition()) {
-							//log::debug("condition is true for {}", trigger.GetName());
-							//Need to make a copy here otherwise insert throws an assertion
-
-							if (blockInput != BlockInputTypes::Never) {
-								std::unordered_set<uint32_t> KeysToAdd = std::unordered_set<uint32_t>(trigger.GetKeys());
-								//log::debug("ShouldBlock is true for {}", trigger.GetName());
-								KeysToBlock.insert(KeysToAdd.begin(), KeysToAdd.end());
-							}
-						}
-						else {
-							//log::debug("Condition Was False For Event: {}", trigger.GetName());
-							//If False Skip calling ShouldFire as there is no point in processing an event that won't do anything
+				if (blockInput == BlockInputTypes::Always) {
+					//If force blocking is set block game input regardless of conditions
+					KeysToBlock |= trigger.GetKeys();
+
+					if (eventData->condition != nullptr) {
+						if (!eventData->condition()) {
 							continue;
 						}
 					}
-				}
 
-				catch (const std::out_of_range&) {
-					log::warn("Event {} was triggered but there is no event of that name", trigger.GetName());
-					continue;
+				}
+				//The condition callback can be null, check before calling it.
+				//In the case it's null input blocking or early continuing won't be done and the system will behave like previously unless its forced.
+				else if (eventData->condition != nullptr) {
+					//Used to verify wether this trigger will actually end up doing anthing
+					if (eventData->condition()) {
+						if (blockInput != BlockInputTypes::Never) {
+							KeysToBlock |= trigger.GetKeys();
+						}
+					}
+					else {
+						//If False Skip calling ShouldFire as there is no point in processing an event that won't do anything
+						continue;
+					}
 				}
 			}
 
 			//Handles Event tiggering conditions
 			if (trigger.ShouldFire(gameInputKeys)) {
 				bool groupAlreadyFired = false;
-				for (auto firedTrigger : firedTriggers) {
+				for (auto firedTrigger : this->firedTriggers) {
 					if (trigger.SameGroup(*firedTrigger)) {
 						groupAlreadyFired = true;
 						break;
@@ -173,28 +194,24 @@ namespace GTS {
 				}
 				else {
 					log::debug("Running event {}", trigger.GetName());
-					firedTriggers.push_back(&trigger);
-					try {
-						auto& eventData = this->registedInputEvents.at(trigger.GetName());
-						eventData.callback(trigger);
-					}
-					catch (const std::out_of_range&) {
-						log::warn("Event {} was triggered but there is no event of that name", trigger.GetName());
-					}
+					this->firedTriggers.push_back(&trigger);
+					eventData->callback(trigger);
 				}
 			}
 		}
 
+		if (KeysToBlock.none()) {
+			return;
+		}
+
 		while (event != nullptr) {
 			bool shouldDispatch = true;
 			if (event->eventType == RE::INPUT_EVENT_TYPE::kButton) {
 				const auto button = skyrim_cast<RE::ButtonEvent*>(event);
-				if (button) {
-					uint32_t input = button->GetIDCode();
-					if (KeysToBlock.contains(input)) {
-						//logger::debug("Blocked Input For Key {}", input);
-						shouldDispatch = false;
-					}
+				std::uint32_t input = 0;
+				if (button && GetKeyIndex(button, input) && KeysToBlock.test(input)) {
+					//logger::debug("Blocked Input For Key {}", input);
+					shouldDispatch = false;
 				}
 			}
 
@@ -37,5 +37,8 @@ namespace GTS {
 		std::mutex LoadLock;
 		std::unordered_map<std::string, RegisteredInputEvent> registedInputEvents;
 		std::vector<ManagedInputEvent> ManagedTriggers;
+		// Resolved once in Init, same order as ManagedTriggers (nullptr if nothing is registered under that name)
+		std::vector<RegisteredInputEvent*> TriggerEvents;
+		std::vector<ManagedInputEvent*> firedTriggers;
 	};
 }
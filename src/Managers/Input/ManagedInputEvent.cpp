@@ -32,11 +32,14 @@ namespace GTS {
 			}
 			try {
 				std::uint32_t key_code = NAMED_KEYS.at(upper_key);
-				this->keys.emplace(key_code);
+				if (key_code >= InputKeyCount) {
+					throw std::out_of_range("key code");
+				}
+				this->keys.set(key_code);
 			}
 			catch (const std::out_of_range&) {
 				log::warn("Key named {}=>{} in {} was unrecongized.", key, upper_key, this->name);
-				this->keys.clear();
+				this->keys.reset();
 				return; // Remove all keys and return so that this becomes an INVALID key entry and won't fire
 			}
 		}
@@ -71,30 +74,20 @@ namespace GTS {
 		return false;
 	}
 
-	bool ManagedInputEvent::AllKeysPressed(const std::unordered_set<std::uint32_t>& keys) const {
+	bool ManagedInputEvent::AllKeysPressed(const InputKeyMask& keys) const {
 
-		if (this->keys.empty()) {
+		if (this->keys.none()) {
 			return false;
 		}
 
-		for (const auto& key : this->keys) {
-			if (!keys.contains(key)) {
-				// Key not found
-				return false;
-			}
-		}
-		return true;
+		return (this->keys & keys) == this->keys;
 	}
 
-	bool ManagedInputEvent::OnlyKeysPressed(const std::unordered_set<std::uint32_t>& keys_in) const {
-		std::unordered_set<std::uint32_t> keys(keys_in); // Copy
-		for (const auto& key : this->keys) {
-			keys.erase(key);
-		}
-		return keys.empty();
+	bool ManagedInputEvent::OnlyKeysPressed(const InputKeyMask& keys) const {
+		return (keys & ~this->keys).none();
 	}
 
-	bool ManagedInputEvent::ShouldFire(const std::unordered_set<std::uint32_t>& a_gameInputKeys) {
+	bool ManagedInputEvent::ShouldFire(const InputKeyMask& a_gameInputKeys) {
 		bool shouldFire = false;
 		// Check based on keys and duration
 		if (this->AllKeysPressed(a_gameInputKeys) && (!this->exclusive || this->OnlyKeysPressed(a_gameInputKeys))) {
@@ -179,15 +172,15 @@ namespace GTS {
 	}
 
 	bool ManagedInputEvent::HasKeys() const {
-		return !this->keys.empty();
+		return this->keys.any();
 	}
 
 	std::string ManagedInputEvent::GetName() const {
 		return this->name;
 	}
 
-	unordered_set<std::uint32_t> ManagedInputEvent::GetKeys() {
-		return keys;
+	const InputKeyMask& ManagedInputEvent::GetKeys() const {
+		return this->keys;
 	}
 
 	BlockInputTypes ManagedInputEvent::ShouldBlock() const {
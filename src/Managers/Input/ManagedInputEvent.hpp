@@ -4,6 +4,10 @@
 
 namespace GTS {
 
+	// Keyboard scan codes followed by mouse buttons (MOUSE_OFFSET)
+	constexpr std::size_t InputKeyCount = MOUSE_OFFSET * 2;
+	using InputKeyMask = std::bitset<InputKeyCount>;
+
 	enum class InputEventState : std::uint8_t {
 		Idle,
 		Held,
@@ -19,15 +23,15 @@ namespace GTS {
 
 		// Will take a key list and process if the event should fire.
 		//   will return true if the events conditions are met
-		[[nodiscard]] bool ShouldFire(const std::unordered_set<std::uint32_t>& keys);
+		[[nodiscard]] bool ShouldFire(const InputKeyMask& keys);
 
 		// Returns true if all keys are pressed this frame
 		//  Not taking into account things like duration
-		[[nodiscard]] bool AllKeysPressed(const std::unordered_set<std::uint32_t>& keys) const;
+		[[nodiscard]] bool AllKeysPressed(const InputKeyMask& keys) const;
 
 		// Returns true if ONLY the specicified keys are pressed this frame
 		//   Not taking into account things like duration
-		[[nodiscard]] bool OnlyKeysPressed(const std::unordered_set<std::uint32_t>& keys) const;
+		[[nodiscard]] bool OnlyKeysPressed(const InputKeyMask& keys) const;
 
 		// Resets the timer and all appropiate state variables
 		void Reset();
@@ -48,7 +52,7 @@ namespace GTS {
 		// of mutaally exclusive triggers
 		[[nodiscard]] bool SameGroup(const ManagedInputEvent& other) const;
 
-		[[nodiscard]] unordered_set<std::uint32_t> GetKeys();
+		[[nodiscard]] const InputKeyMask& GetKeys() const;
 
 		[[nodiscard]] BlockInputTypes ShouldBlock() const;
 
@@ -60,7 +64,7 @@ namespace GTS {
 		bool primed = false; // Used for release events. Once primed, when keys are not pressed we fire
 
 		std::string name;
-		unordered_set<std::uint32_t> keys = {};
+		InputKeyMask keys = {};
 		float minDuration = 0.0f;
 
 		// If true this event won't fire unles ONLY the keys are pressed for the entire duration
@@ -41,24 +41,14 @@ namespace GTS {
 
 	void OverkillManager::Update() {
 		GTS_PROFILE_SCOPE("OverkillManager: Update");
-		for (auto &[tinyId, data]: this->data) {
-			auto tiny = TESForm::LookupByID<Actor>(tinyId);
-			auto giantHandle = data.giant;
-			if (!tiny) {
-				continue;
-			}
-			if (!giantHandle) {
-				continue;
-			}
-			auto giant = giantHandle.get().get();
-			if (!giant) {
-				continue;
-			}
-			if (data.state == OverkillState::Healthy) {
+		this->data.PruneFinished();
+
+		this->data.Advance([](FinisherTable::Slot& slot, Actor* giant, Actor* tiny) {
+			if (slot.stage == FinisherStage::Start) {
 				SetReanimatedState(tiny);
-				data.state = OverkillState::Overkilling;
-			} else if (data.state == OverkillState::Overkilling) {
-				if (data.delay.ShouldRun()) {
+				return FinisherStep::Next;
+			} else {
+				if (slot.delay.ShouldRun()) {
                     if (tiny->Is3DLoaded() && !tiny->IsDead()) {
 						DecreaseShoutCooldown(giant);
                         KillActor(giant, tiny);
@@ -80,21 +70,22 @@ namespace GTS {
                         tiny->SetAlpha(0.0f); // Player can't be disintegrated, so we make player Invisible
                     }
 
-                    data.state = OverkillState::Overkilled;
 					Attacked(tiny, giant);
+					return FinisherStep::Done;
 				}
+				return FinisherStep::Wait;
 			}
-		}
+		});
 	}
 
 
 	void OverkillManager::Reset() {
-		this->data.clear();
+		this->data.Clear();
 	}
 
 	void OverkillManager::ResetActor(Actor* actor) {
 		if (actor) {
-			this->data.erase(actor->formID);
+			this->data.Erase(actor->formID);
 		}
 	}
 
@@ -106,7 +97,7 @@ namespace GTS {
 			return;
 		}
 		if (OverkillManager::CanOverkill(giant, tiny)) {
-			OverkillManager::GetSingleton().data.try_emplace(tiny->formID, giant);
+			OverkillManager::GetSingleton().data.Start(giant, tiny);
 		}
 	}
 
@@ -114,8 +105,7 @@ namespace GTS {
 		if (!actor) {
 			return false;
 		}
-		auto& m = OverkillManager::GetSingleton().data;
-		return !(m.find(actor->formID) == m.end());
+		return OverkillManager::GetSingleton().data.Contains(actor->formID);
 	}
 
 	bool OverkillManager::CanOverkill(Actor* giant, Actor* tiny) {
@@ -128,10 +118,4 @@ namespace GTS {
 
 		return true;
 	}
-
-	OverkillData::OverkillData(Actor* giant) :
-		delay(Timer(0.01)),
-		state(OverkillState::Healthy),
-		giant(giant ? giant->CreateRefHandle() : ActorHandle()) {
-	}
 }
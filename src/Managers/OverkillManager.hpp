@@ -1,24 +1,11 @@
 #pragma once
 
+#include "Managers/FinisherTable.hpp"
+
 // Module that handles overkilling others
 
 namespace GTS {
 
-	enum class OverkillState {
-		Healthy,
-		Overkilling,
-		Overkilled
-	};
-
-	class OverkillData {
-		public:
-			OverkillData(Actor* giant);
-
-			OverkillState state;
-			Timer delay;
-			ActorHandle giant;
-	};
-
 	class OverkillManager : public EventListener {
 		public:
 			[[nodiscard]] static OverkillManager& GetSingleton() noexcept;
@@ -32,6 +19,6 @@ namespace GTS {
 			static bool AlreadyOverkilled(Actor* actor);
 			static void Overkill(Actor* giant, Actor* tiny);
 		private:
-			std::unordered_map<FormID, OverkillData> data;
+			FinisherTable data;
 	};
 }
\ No newline at end of file
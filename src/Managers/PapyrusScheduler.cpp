@@ -0,0 +1,73 @@
+#include "Managers/PapyrusScheduler.hpp"
+#include "Managers/Console/ConsoleManager.hpp"
+
+#include "Config/Config.hpp"
+
+namespace {
+
+	void CMD_PapyrusStats() {
+		GTS::PapyrusScheduler::PrintStats();
+	}
+}
+
+namespace GTS {
+
+	PapyrusScheduler& PapyrusScheduler::GetSingleton() noexcept {
+		static PapyrusScheduler instance;
+		return instance;
+	}
+
+	std::string PapyrusScheduler::DebugName() {
+		return "::PapyrusScheduler";
+	}
+
+	void PapyrusScheduler::DataReady() {
+		ConsoleManager::RegisterCommand("papyrusstats", CMD_PapyrusStats, "Print how many PapyrusUpdate passes the VM asked for and how many ran");
+	}
+
+	void PapyrusScheduler::Reset() {
+		this->lastPass = 0.0;
+		this->pending = 0;
+	}
+
+	void PapyrusScheduler::Request() {
+		auto& me = GetSingleton();
+		me.pending += 1;
+		me.requestCount += 1;
+	}
+
+	void PapyrusScheduler::Update() {
+		const double now = Time::WorldTimeElapsed();
+		const float rate = Config::GetAdvanced().fPapyrusUpdateRate;
+		if (rate > 0.0f) {
+			if (now - this->lastPass < 1.0 / rate) {
+				return;
+			}
+			this->pending = 0;
+		}
+		else if (this->pending.exchange(0) == 0) {
+			// 0 = only when the VM asked, still at most once per frame
+			return;
+		}
+		this->lastPass = now;
+
+		GTS_PROFILE_SCOPE("PapyrusScheduler: Pass");
+		const auto start = std::chrono::steady_clock::now();
+		EventDispatcher::DoPapyrusUpdate();
+		this->passMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		this->passCount += 1;
+	}
+
+	void PapyrusScheduler::PrintStats() {
+		auto& me = GetSingleton();
+		const std::uint64_t requests = me.requestCount.exchange(0);
+		const double averageMs = me.passCount > 0 ? me.passMs / static_cast<double>(me.passCount) : 0.0;
+
+		Cprint("--- Papyrus Update Scheduler ---");
+		Cprint("Rate: {:.1f}/s", Config::GetAdvanced().fPapyrusUpdateRate);
+		Cprint("VM OnUpdate triggers: {}", requests);
+		Cprint("Passes run: {}, {:.3f} ms avg", me.passCount, averageMs);
+		me.passCount = 0;
+		me.passMs = 0.0;
+	}
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+// Moves EventListener::PapyrusUpdate off the VM thread onto the main update at a fixed rate
+//
+// PapyrusUpdate used to run a full listener pass every time the VM sent OnUpdate to any script, so how often it
+// ran depended on how many scripts of the load order registered for updates. VM triggers are now only counted
+// and passes run at Advanced.fPapyrusUpdateRate from the main update.
+
+namespace GTS {
+
+	class PapyrusScheduler : public EventListener {
+		public:
+			[[nodiscard]] static PapyrusScheduler& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void DataReady() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+
+			// Called for every OnUpdate the VM sends, safe from any thread
+			static void Request();
+
+			static void PrintStats();
+
+		private:
+			double lastPass = 0.0;
+
+			std::atomic<std::uint64_t> pending = 0;
+			std::atomic<std::uint64_t> requestCount = 0;
+			std::uint64_t passCount = 0;
+			double passMs = 0.0;
+	};
+}
@@ -9,6 +9,7 @@
 #include "Managers/Animation/AnimationManager.hpp"
 #include "Managers/Animation/BoobCrush.hpp"
 #include "Managers/Animation/Grab.hpp"
+#include "Managers/Emotions/EmotionManager.hpp"
 
 #include "Managers/FurnitureManager.hpp"
 
@@ -18,18 +19,26 @@
 #include "Managers/ShrinkToNothingManager.hpp"
 #include "Managers/Perks/PerkHandler.hpp"
 #include "Managers/Damage/CollisionDamage.hpp"
+#include "Managers/Damage/ContactSnapshot.hpp"
+#include "Managers/Damage/DamageBuffer.hpp"
+#include "Managers/Damage/ObjectIndex.hpp"
 #include "Managers/Audio/Footstep.hpp"
+#include "Managers/FootstepBus.hpp"
+#include "Managers/Impact.hpp"
 
 #include "Managers/AI/headtracking.hpp"
 
 #include "Managers/GtsSizeManager.hpp"
 #include "Managers/CrushManager.hpp"
+#include "Utils/DeathReport.hpp"
 #include "Managers/OverkillManager.hpp"
 #include "Managers/RandomGrowth.hpp"
 #include "Managers/Attributes.hpp"
+#include "Managers/RipClothManager.hpp"
 #include "Managers/GtsManager.hpp"
 #include "Managers/HitManager.hpp"
 #include "Managers/Explosion.hpp"
+#include "Managers/EffectScheduler.hpp"
 #include "Managers/Reloader.hpp"
 #include "Managers/Highheel.hpp"
 #include "Managers/Contact.hpp"
@@ -53,19 +62,26 @@ namespace GTS {
 		EventDispatcher::AddListener(&CameraManager::GetSingleton()); // Edits the camera
 		EventDispatcher::AddListener(&ReloadManager::GetSingleton()); // Handles Skyrim Events
 		EventDispatcher::AddListener(&CollisionDamage::GetSingleton()); // Handles precise size-related damage
+		EventDispatcher::AddListener(&ContactSnapshot::GetSingleton()); // Per-frame foot/hand points shared by damage routines
+		EventDispatcher::AddListener(&ObjectIndex::GetSingleton()); // Grid of loaded objects that can be launched or broken
 		EventDispatcher::AddListener(&MagicManager::GetSingleton()); // Manages spells and size changes in general
 		EventDispatcher::AddListener(&VoreController::GetSingleton()); // Manages vore
 		EventDispatcher::AddListener(&CrushManager::GetSingleton()); // Manages crushing
+		EventDispatcher::AddListener(&DeathReporter::GetSingleton()); // Prints queued death messages and applies kill counts
 		EventDispatcher::AddListener(&OverkillManager::GetSingleton()); // Manages crushing
 		EventDispatcher::AddListener(&ShrinkToNothingManager::GetSingleton()); // Shrink to nothing manager
 		EventDispatcher::AddListener(&FootStepManager::GetSingleton()); // Manages footstep sounds
+		EventDispatcher::AddListener(&FootstepBus::GetSingleton()); // Sends queued Papyrus OnFootstep events once per frame
+		ImpactManager::SubscribeFootsteps(); // Footstep impacts run as a FootstepBus subscriber
 		EventDispatcher::AddListener(&TremorManager::GetSingleton()); // Manages tremors on footsteps
 		EventDispatcher::AddListener(&ExplosionManager::GetSingleton()); // Manages clouds/exposions on footstep
 		EventDispatcher::AddListener(&Rumbling::GetSingleton()); // Manages rumbling of contoller/camera for multiple frames
 		EventDispatcher::AddListener(&AttributeManager::GetSingleton()); // Adjusts most attributes
+		EventDispatcher::AddListener(&ClothManager::GetSingleton()); // Classifies armors for clothing rip and remembers what was ripped
 		EventDispatcher::AddListener(&RandomGrowth::GetSingleton()); // Manages random growth perk
 		EventDispatcher::AddListener(&HitManager::GetSingleton()); // Hit Manager for handleing papyrus hit events
 		EventDispatcher::AddListener(&AnimationManager::GetSingleton()); // Manages Animation Events
+		EventDispatcher::AddListener(&EmotionManager::GetSingleton()); // Animates phoneme and modifier morphs
 		EventDispatcher::AddListener(&Grab::GetSingleton()); // Manages grabbing
 		EventDispatcher::AddListener(&ThighSandwichController::GetSingleton()); // Manages Thigh Sandwiching
 		EventDispatcher::AddListener(&AnimationBoobCrush::GetSingleton());
@@ -75,6 +91,8 @@ namespace GTS {
 		EventDispatcher::AddListener(&ContactManager::GetSingleton()); // Manages collisions
 		EventDispatcher::AddListener(&DynamicScale::GetSingleton()); // Handles room heights
 		EventDispatcher::AddListener(&FurnitureManager::GetSingleton()); // Handles furniture stuff
+		EventDispatcher::AddListener(&DamageBuffer::GetSingleton()); // Applies the size damage summed this frame and runs crush checks
+		EventDispatcher::AddListener(&EffectScheduler::GetSingleton()); // Spawns the particles and explosions queued this frame, keep last
 		log::info("Managers Registered");
 	}
 }
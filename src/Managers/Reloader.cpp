@@ -13,6 +13,8 @@ namespace GTS {
 			event_sources->AddEventSink<TESEquipEvent>(this);
 			event_sources->AddEventSink<TESTrackedStatsEvent>(this);
 			event_sources->AddEventSink<TESResetEvent>(this);
+			event_sources->AddEventSink<TESMagicEffectApplyEvent>(this);
+			event_sources->AddEventSink<TESCellAttachDetachEvent>(this);
 			//event_sources->AddEventSink<TESFurnitureEvent>(this); // Uncomment it to enable this event!
 			// Also don't forget to uncomment data->UsingFurniture inside PerformRoofRaycastAdjustments
 		}
@@ -44,10 +46,13 @@ namespace GTS {
 	BSEventNotifyControl ReloadManager::ProcessEvent(const TESObjectLoadedEvent * evn, BSTEventSource<TESObjectLoadedEvent>* dispatcher)
 	{
 		if (evn) {
-			auto* actor = TESForm::LookupByID<Actor>(evn->formID);
-			if (actor) {
+			auto* ref = TESForm::LookupByID<TESObjectREFR>(evn->formID);
+			if (auto* actor = ref ? ref->As<Actor>() : nullptr) {
 				EventDispatcher::DoActorLoaded(actor);
 			}
+			else if (ref) {
+				EventDispatcher::DoReferenceLoaded(ref, evn->loaded);
+			}
 		}
 		return BSEventNotifyControl::kContinue;
 	}
@@ -106,4 +111,26 @@ namespace GTS {
 		return RE::BSEventNotifyControl::kContinue;
 	}
 
+	BSEventNotifyControl ReloadManager::ProcessEvent(const TESMagicEffectApplyEvent* a_event, BSTEventSource<TESMagicEffectApplyEvent>* a_eventSource)
+	{
+		if (a_event && a_event->target) {
+			auto* actor = a_event->target->As<Actor>();
+			auto* effect = TESForm::LookupByID<EffectSetting>(a_event->magicEffect);
+			if (actor && effect) {
+				EventDispatcher::DoMagicEffectApply(actor, effect);
+			}
+		}
+		return BSEventNotifyControl::kContinue;
+	}
+
+	BSEventNotifyControl ReloadManager::ProcessEvent(const TESCellAttachDetachEvent* a_event, BSTEventSource<TESCellAttachDetachEvent>* a_eventSource)
+	{
+		if (a_event && a_event->reference) {
+			auto* ref = a_event->reference.get();
+			if (!ref->Is(FormType::ActorCharacter)) {
+				EventDispatcher::DoReferenceLoaded(ref, a_event->attached);
+			}
+		}
+		return BSEventNotifyControl::kContinue;
+	}
 }
@@ -11,7 +11,9 @@ namespace GTS {
 		public BSTEventSink<TESEquipEvent>,
 		public BSTEventSink<TESTrackedStatsEvent>,
 		public BSTEventSink<MenuOpenCloseEvent>,
-		public BSTEventSink<TESFurnitureEvent> {
+		public BSTEventSink<TESFurnitureEvent>,
+		public BSTEventSink<TESMagicEffectApplyEvent>,
+		public BSTEventSink<TESCellAttachDetachEvent> {
 		public:
 			[[nodiscard]] static ReloadManager& GetSingleton() noexcept;
 
@@ -26,5 +28,7 @@ namespace GTS {
 			virtual BSEventNotifyControl ProcessEvent(const TESTrackedStatsEvent* evn, BSTEventSource<TESTrackedStatsEvent>* dispatcher) override;
 			virtual BSEventNotifyControl ProcessEvent(const MenuOpenCloseEvent* a_event, BSTEventSource<MenuOpenCloseEvent>* a_eventSource) override;
 			virtual BSEventNotifyControl ProcessEvent(const TESFurnitureEvent* a_event, BSTEventSource<TESFurnitureEvent>* a_eventSource) override;
+			virtual BSEventNotifyControl ProcessEvent(const TESMagicEffectApplyEvent* a_event, BSTEventSource<TESMagicEffectApplyEvent>* a_eventSource) override;
+			virtual BSEventNotifyControl ProcessEvent(const TESCellAttachDetachEvent* a_event, BSTEventSource<TESCellAttachDetachEvent>* a_eventSource) override;
 	};
 }
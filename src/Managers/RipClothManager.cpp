@@ -58,6 +58,14 @@ namespace GTS {
 		// BGSBipedObjectForm::BipedObjectSlot::kFX01,					// 61
 	};
 
+	static const std::uint32_t VallidSlotMask = [] {
+		std::uint32_t mask = 0;
+		for (auto Slot : VallidSlots) {
+			mask |= static_cast<std::uint32_t>(Slot);
+		}
+		return mask;
+	}();
+
 	ClothManager& ClothManager::GetSingleton() noexcept {
 		static ClothManager instance;
 		return instance;
@@ -67,26 +75,120 @@ namespace GTS {
 		return "::ClothManager";
 	}
 
-	//Add A check bool to transient to decect npc_reequips
+	void ClothManager::DataReady() {
+		this->armorClasses.clear();
+		auto DataHandler = RE::TESDataHandler::GetSingleton();
+		if (!DataHandler) {
+			return;
+		}
+		for (auto Armor : DataHandler->GetFormArray<TESObjectARMO>()) {
+			if (Armor) {
+				this->armorClasses.emplace(Armor->formID, this->Classify(Armor));
+			}
+		}
+		log::info("ClothManager: Classified {} armors", this->armorClasses.size());
+	}
+
+	void ClothManager::Reset() {
+		this->ripped.clear();
+	}
+
+	void ClothManager::ResetActor(Actor* actor) {
+		if (actor) {
+			this->ripped.erase(actor->formID);
+		}
+	}
+
+	ClothManager::ArmorClass ClothManager::Classify(TESObjectARMO* a_armor) const {
+		auto found = this->armorClasses.find(a_armor->formID);
+		if (found != this->armorClasses.end()) {
+			return found->second;
+		}
+
+		// Forms made at runtime (enchanted copies and such) are not in the table, classify them on the spot
+		ArmorClass result;
+		result.slotMask = a_armor->bipedModelData.bipedObjectSlots.underlying();
+		for (const auto& BKwd : KeywordBlackList) {
+			if (a_armor->HasKeywordString(BKwd)) {
+				result.blacklisted = true;
+				break;
+			}
+		}
+		result.rippable = !result.blacklisted && (result.slotMask & VallidSlotMask) != 0;
+		return result;
+	}
+
+	void ClothManager::RecordRipped(Actor* a_actor, TESObjectARMO* a_armor) {
+		auto& Armors = this->ripped[a_actor->formID];
+		if (std::ranges::find(Armors, a_armor->formID) == Armors.end()) {
+			Armors.push_back(a_armor->formID);
+		}
+	}
 
 	//I don't like this. Ideally we should call the same update func that the game does when the npc changes cells for example.
 	//But alas i have no idea how to do that :(
-	//This will equip all armor in the inventory
-	static void ReEquipClothing(Actor* a_actor) {
+	//This will equip all armor we ripped off that is still in the inventory
+	void ClothManager::ReEquipClothing(Actor* a_actor) {
 		//log::info("ReEquip: {}", a_actor->GetName());
-		const auto inv = a_actor->GetInventory();
-		for (const auto& [item, invData] : inv) {
-			const auto& [count, entry] = invData;
-			if (count > 0) {
-				if (item->As<RE::TESObjectARMO>()) {
-					if (!entry->extraLists) {
-						return;
-					}
-					for (const auto& xList : *entry->extraLists) {
-						RE::ActorEquipManager::GetSingleton()->EquipObject(a_actor, item, xList, 1, nullptr, false, false, false);
+		std::vector<FormID> Armors;
+		if (auto found = this->ripped.find(a_actor->formID); found != this->ripped.end()) {
+			Armors = std::move(found->second);
+			this->ripped.erase(found);
+		}
+
+		// Only builds entries for the ripped items instead of copying the whole inventory
+		const bool Recorded = !Armors.empty();
+		const auto inv = a_actor->GetInventory([&Armors, Recorded](TESBoundObject& a_object) {
+			return Recorded ? std::ranges::find(Armors, a_object.formID) != Armors.end() : a_object.IsArmor();
+		});
+
+		// Nothing recorded means they were ripped before the last load, the records aren't saved.
+		// Put back what the old code did, rippable armors carrying extra data (given, tempered or enchanted),
+		// then fill the slots still free from the default outfit
+		if (!Recorded) {
+			for (const auto& [Item, InvData] : inv) {
+				const auto& [count, entry] = InvData;
+				auto Armor = Item->As<TESObjectARMO>();
+				if (Armor && count > 0 && entry->extraLists && !entry->extraLists->empty() && this->Classify(Armor).rippable) {
+					Armors.push_back(Armor->formID);
+				}
+			}
+			auto Base = a_actor->GetActorBase();
+			auto Outfit = Base ? Base->defaultOutfit : nullptr;
+			if (Outfit) {
+				for (auto Item : Outfit->outfitItems) {
+					auto Armor = Item ? Item->As<TESObjectARMO>() : nullptr;
+					if (Armor && this->Classify(Armor).rippable && std::ranges::find(Armors, Armor->formID) == Armors.end()) {
+						Armors.push_back(Armor->formID);
 					}
 				}
 			}
+			if (Armors.empty()) {
+				return;
+			}
+		}
+
+		// One armor per biped slot in the order they came off, a second one would just unequip the first
+		std::uint32_t Covered = 0;
+		auto manager = RE::ActorEquipManager::GetSingleton();
+		for (const FormID ArmorID : Armors) {
+			auto Armor = TESForm::LookupByID<TESObjectARMO>(ArmorID);
+			auto found = Armor ? inv.find(Armor) : inv.end();
+			if (found == inv.end()) {
+				continue;
+			}
+			const auto& [count, entry] = found->second;
+			if (count <= 0) {
+				continue;
+			}
+			const std::uint32_t Slots = this->Classify(Armor).slotMask;
+			if (Covered & Slots) {
+				continue;
+			}
+			Covered |= Slots;
+			// Only one instance per armor, the slots are taken after the first
+			ExtraDataList* xList = entry->extraLists && !entry->extraLists->empty() ? entry->extraLists->front() : nullptr;
+			manager->EquipObject(a_actor, Armor, xList, 1, nullptr, false, false, false);
 		}
 	}
 
@@ -130,34 +232,32 @@ namespace GTS {
 		return Shrinking;
 	}
 
-	static void RipRandomClothing(RE::Actor* a_actor) {
+	void ClothManager::RipRandomClothing(RE::Actor* a_actor) {
 
 		if(!a_actor) {
 			return;
 		}
 
 		std::vector<TESObjectARMO*> ArmorList;
+		std::uint32_t Covered = 0;
 		for (auto Slot : VallidSlots) {
 
+			// Already found the armor worn in this slot
+			if (Covered & static_cast<std::uint32_t>(Slot)) {
+				continue;
+			}
+
 			auto Armor = a_actor->GetWornArmor(Slot);
 			// If armor is null skip
 			if (!Armor) {
 				continue;
 			}
 
-			for (const auto& BKwd : KeywordBlackList) {
-				if (Armor->HasKeywordString(BKwd)) {
-					goto BKwd_Skip; //If blacklisted keyword is found skip
-				}
-				                                  
+			const ArmorClass Class = this->Classify(Armor);
+			Covered |= Class.slotMask;
+			if (Class.rippable) {
+				ArmorList.push_back(Armor);
 			}
-
-			//Else Add it to the vector
-			ArmorList.push_back(Armor);
-
-			//Funny label
-		BKwd_Skip:
-			continue;
 		}
 
 		uint32_t ArmorCount = static_cast<uint32_t>(ArmorList.size());
@@ -174,6 +274,7 @@ namespace GTS {
 
 		auto manager = RE::ActorEquipManager::GetSingleton();
 		manager->UnequipObject(a_actor, tesarmo, nullptr, 1, nullptr, true, false, false);
+		this->RecordRipped(a_actor, tesarmo);
 
 		Rumbling::Once("ClothManager", a_actor, Rumble_Misc_TearClothes, 0.075f);
 		Sound_PlayMoans(a_actor, 0.7f, 0.14f, EmotionTriggerSource::RipCloth);
@@ -183,7 +284,7 @@ namespace GTS {
 		
 	}
 
-	static void RipAllClothing(RE::Actor* a_actor) {
+	void ClothManager::RipAllClothing(RE::Actor* a_actor) {
 
 		if (!a_actor) {
 			return;
@@ -191,28 +292,29 @@ namespace GTS {
 
 		auto manager = RE::ActorEquipManager::GetSingleton();
 		bool Ripped = false;
+		std::uint32_t Covered = 0;
 
 		for (auto Slot : VallidSlots) {
 
+			if (Covered & static_cast<std::uint32_t>(Slot)) {
+				continue;
+			}
+
 			TESObjectARMO* Armor = a_actor->GetWornArmor(Slot);
 			// If armor is null skip
 			if (!Armor) {
 				continue;
 			}
 
-			for (const auto& BKwd : KeywordBlackList) {
-				if (Armor->HasKeywordString(BKwd)) {
-					//Simplest way to break the parent loop
-					goto BKwd_Skip;
-				}
+			const ArmorClass Class = this->Classify(Armor);
+			Covered |= Class.slotMask;
+			if (!Class.rippable) {
+				continue;
 			}
-			
+
 			manager->UnequipObject(a_actor, Armor, nullptr, 1, nullptr, true, false, false);
+			this->RecordRipped(a_actor, Armor);
 			Ripped = true;
-
-			//Funny label
-			BKwd_Skip:
-			     continue;
 		}
 
 		if (Ripped) {
@@ -223,7 +325,7 @@ namespace GTS {
 		}
 	}
 
-	void ClothManager::CheckClothingRip(Actor* a_actor) const {
+	void ClothManager::CheckClothingRip(Actor* a_actor) {
 
 		if (!a_actor) return;
 
@@ -256,7 +358,7 @@ namespace GTS {
 
 				//ReEquip Ripped Clothing On Follower NPC's
 				if (a_actor->formID != 0x14 && IsTeammate(a_actor)) {
-					ReEquipClothing(a_actor);
+					this->ReEquipClothing(a_actor);
 				}
 			}
 			return;
@@ -265,7 +367,7 @@ namespace GTS {
 		//Rip Immediatly if too big.
 		//Its a bit wastefull but allows us to imediatly unequip if the player equips something again
 		if (CurrentScale > rip_tooBig) {
-			RipAllClothing(a_actor);
+			this->RipAllClothing(a_actor);
 			return;
 		}
 
@@ -282,7 +384,7 @@ namespace GTS {
 		if (CurrentScale >= (rip_threshold + actordata->ClothRipOffset + Offs)) {
 			actordata->ClothRipOffset = CurrentScale - rip_threshold + Offs;
 			//log::info("Offset After Rip {}", actordata->rip_offset);
-			RipRandomClothing(a_actor);
+			this->RipRandomClothing(a_actor);
 			return;
 		}
 	}
@@ -310,20 +412,8 @@ namespace GTS {
 
 		//if the item is not an armor, allow it
 		if (!TESArmo) return false;
-		for (auto Slot : VallidSlots) {
-			//For each vallid slot check if the to be equiped slot cotains said slot
-			if (TESArmo->bipedModelData.bipedObjectSlots.any(Slot)) {
 
-				//if it does, check the keywords as a last resort
-				for (const auto& BKwd : KeywordBlackList) {
-					if (TESArmo->HasKeywordString(BKwd)) {
-						return false; //If blacklisted keyword is found do not strip
-					}
-				}
-				return true;
-			}
-		}
-		//if not within a vallid slot, allow.
-		return false;
+		//Block it if it covers a vallid slot and has no blacklisted keyword
+		return GetSingleton().Classify(TESArmo).rippable;
 	}
 }
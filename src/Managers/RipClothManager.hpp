@@ -1,5 +1,8 @@
 #pragma once
-// Module that handles AttributeValues
+// Module that rips clothing off growing followers and puts it back on once they shrink
+//
+// Every armor form is classified once at data load (slots it covers, whether a keyword blacklists it)
+// so ripping and the equip hook only test bits instead of comparing keyword strings.
 
 
 namespace GTS {
@@ -9,12 +12,36 @@ namespace GTS {
 		public:
 			[[nodiscard]] static ClothManager& GetSingleton() noexcept;
 			virtual std::string DebugName() override;
+			virtual void DataReady() override;
+			virtual void Reset() override;
+			virtual void ResetActor(Actor* actor) override;
 
-			void CheckClothingRip(Actor* a_actor) const;
+			void CheckClothingRip(Actor* a_actor);
 			static bool ShouldPreventReEquip(Actor* a_actor, RE::TESBoundObject* a_object);
 			float ReConstructOffset(Actor* a_actor, float scale) const;
 
 			const float rip_randomOffsetMax = 0.10f;
 
+		private:
+			struct ArmorClass {
+				// Biped slots the armor covers
+				std::uint32_t slotMask = 0;
+				// Has a keyword from the blacklist
+				bool blacklisted = false;
+				// Covers a ripped slot and isn't blacklisted
+				bool rippable = false;
+			};
+
+			[[nodiscard]] ArmorClass Classify(TESObjectARMO* a_armor) const;
+			void RipRandomClothing(Actor* a_actor);
+			void RipAllClothing(Actor* a_actor);
+			void ReEquipClothing(Actor* a_actor);
+			void RecordRipped(Actor* a_actor, TESObjectARMO* a_armor);
+
+			// Filled in DataReady and read only afterwards, the equip hook reads it too
+			std::unordered_map<FormID, ArmorClass> armorClasses;
+			// Armors ripped off each actor, in the order they came off
+			std::unordered_map<FormID, std::vector<FormID>> ripped;
+
 	};
 }
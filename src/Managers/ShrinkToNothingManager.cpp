@@ -29,24 +29,13 @@ namespace GTS {
 
 	void ShrinkToNothingManager::Update() {
 		GTS_PROFILE_SCOPE("ShrinkToNothingManager: Update");
-		for (auto &[tinyId, data]: this->data) {
-			auto tiny = TESForm::LookupByID<Actor>(tinyId);
-			auto giantHandle = data.giant;
-			if (!tiny) {
-				continue;
-			}
-			if (!giantHandle) {
-				continue;
-			}
-			auto giant = giantHandle.get().get();
-			if (!giant) {
-				continue;
-			}
+		this->data.PruneFinished();
 
-			if (data.state == ShrinkState::Healthy) {
+		this->data.Advance([](FinisherTable::Slot& slot, Actor* giant, Actor* tiny) {
+			if (slot.stage == FinisherStage::Start) {
 				SetReanimatedState(tiny);
-				data.state = ShrinkState::Shrinking;
-			} else if (data.state == ShrinkState::Shrinking) {
+				return FinisherStep::Next;
+			} else {
 				ModSizeExperience(giant, 0.24f * GetXPModifier(tiny)); // Adjust Size Matter skill
 				Attacked(tiny, giant);
 				if (giant->formID == 0x14 && IsDragon(tiny)) {
@@ -65,20 +54,20 @@ namespace GTS {
 
 				ShrinkToNothingManager::TransferInventoryTask(giant, tiny); // Also plays STN sound
 
-				data.state = ShrinkState::Shrinked;
+				return FinisherStep::Done;
 			}
-		}
+		});
 	}
 	
 
 
 	void ShrinkToNothingManager::Reset() {
-		this->data.clear();
+		this->data.Clear();
 	}
 
 	void ShrinkToNothingManager::ResetActor(Actor* actor) {
 		if (actor) {
-			this->data.erase(actor->formID);
+			this->data.Erase(actor->formID);
 		}
 	}
 
@@ -90,7 +79,7 @@ namespace GTS {
 			return;
 		}
 		if (ShrinkToNothingManager::CanShrink(giant, tiny)) {
-			ShrinkToNothingManager::GetSingleton().data.try_emplace(tiny->formID, giant);
+			ShrinkToNothingManager::GetSingleton().data.Start(giant, tiny);
 		}
 	}
 
@@ -98,8 +87,7 @@ namespace GTS {
 		if (!actor) {
 			return false;
 		}
-		auto& m = ShrinkToNothingManager::GetSingleton().data;
-		return !(m.find(actor->formID) == m.end());
+		return ShrinkToNothingManager::GetSingleton().data.Contains(actor->formID);
 	}
 
 	bool ShrinkToNothingManager::CanShrink(Actor* giant, Actor* tiny) {
@@ -170,10 +158,4 @@ namespace GTS {
 			tiny->SetAlpha(0.0f); // Player can't be disintegrated, so we make player Invisible
 		}
 	}
-
-	ShrinkData::ShrinkData(Actor* giant) :
-		delay(Timer(0.01)),
-		state(ShrinkState::Healthy),
-		giant(giant ? giant->CreateRefHandle() : ActorHandle()) {
-	}
 }
@@ -1,24 +1,11 @@
 #pragma once
 
+#include "Managers/FinisherTable.hpp"
+
 // Module that handles shrinking to nothing
 
 namespace GTS {
 
-	enum class ShrinkState {
-		Healthy,
-		Shrinking,
-		Shrinked
-	};
-
-	class ShrinkData {
-		public:
-			ShrinkData(Actor* giant);
-
-			ShrinkState state;
-			Timer delay;
-			ActorHandle giant;
-	};
-
 	class ShrinkToNothingManager : public EventListener {
 		public:
 			[[nodiscard]] static ShrinkToNothingManager& GetSingleton() noexcept;
@@ -35,6 +22,6 @@ namespace GTS {
 			static void SpawnDeathEffects(Actor* tiny);
 			static void TransferInventoryTask(Actor* giant, Actor* tiny);
 		private:
-			std::unordered_map<FormID, ShrinkData> data;
+			FinisherTable data;
 	};
 }
@@ -1,4 +1,5 @@
 #include "Papyrus/Height.hpp"
+#include "Scale/ScaleSnapshot.hpp"
 
 using namespace GTS;
 using namespace RE::BSScript;
@@ -6,9 +7,22 @@ using namespace RE::BSScript;
 namespace {
 	constexpr std::string_view PapyrusClass = "GTSHeight";
 
+	// Heights scale with the actor's base height, which only the main thread can read,
+	// so the getters are frame-synced and read the live values. Setters refresh the scale snapshot
+
+	std::vector<float> GetMany(const std::vector<Actor*>& actors, float (*getter)(Actor*)) {
+		std::vector<float> result;
+		result.reserve(actors.size());
+		for (auto actor : actors) {
+			result.push_back(getter(actor));
+		}
+		return result;
+	}
+
 	// Target Scales
 	void SetTargetHeight(StaticFunctionTag*, Actor* actor, float height) {
 		set_target_height(actor, height);
+		ScaleSnapshot::Refresh(actor);
 	}
 
 	float GetTargetHeight(StaticFunctionTag*, Actor* actor) {
@@ -17,10 +31,12 @@ namespace {
 
 	void ModTargetHeight(StaticFunctionTag*, Actor* actor, float amt) {
 		mod_target_height(actor, amt);
+		ScaleSnapshot::Refresh(actor);
 	}
 
 	void SetMaxHeight(StaticFunctionTag*, Actor* actor, float height) {
 		set_max_height(actor, height);
+		ScaleSnapshot::Refresh(actor);
 	}
 
 	float GetMaxHeight(StaticFunctionTag*, Actor* actor) {
@@ -29,12 +45,25 @@ namespace {
 
 	void ModMaxHeight(StaticFunctionTag*, Actor* actor, float amt) {
 		mod_max_height(actor, amt);
+		ScaleSnapshot::Refresh(actor);
 	}
 
 	float GetVisualHeight(StaticFunctionTag*, Actor* actor) {
 		return get_visual_height(actor);
 	}
 
+	// Bulk
+	std::vector<float> GetTargetHeights(StaticFunctionTag*, std::vector<Actor*> actors) {
+		return GetMany(actors, get_target_height);
+	}
+
+	std::vector<float> GetMaxHeights(StaticFunctionTag*, std::vector<Actor*> actors) {
+		return GetMany(actors, get_max_height);
+	}
+
+	std::vector<float> GetVisualHeights(StaticFunctionTag*, std::vector<Actor*> actors) {
+		return GetMany(actors, get_visual_height);
+	}
 }
 
 namespace GTS {
@@ -53,6 +82,11 @@ namespace GTS {
 		//Visual Height
 		vm->RegisterFunction("GetVisualHeight", PapyrusClass, GetVisualHeight);
 
+		//Bulk
+		vm->RegisterFunction("GetTargetHeights", PapyrusClass, GetTargetHeights);
+		vm->RegisterFunction("GetMaxHeights", PapyrusClass, GetMaxHeights);
+		vm->RegisterFunction("GetVisualHeights", PapyrusClass, GetVisualHeights);
+
 		return true;
 	}
 }
@@ -1,5 +1,6 @@
 #include "Papyrus/ModEvents.hpp"
 #include "Managers/ModEvent.hpp"
+#include "Managers/FootstepBus.hpp"
 
 using namespace GTS;
 using namespace RE::BSScript;
@@ -11,16 +12,20 @@ namespace {
 		if (!form) {
 			return;
 		}
-		auto event_manager = ModEventManager::GetSingleton();
-		event_manager.m_onfootstep.Register(form);
+		auto& event_manager = ModEventManager::GetSingleton();
+		if (event_manager.m_onfootstep.Register(form)) {
+			FootstepBus::OnPapyrusRegister(true);
+		}
 	}
 
 	void UnRegisterOnFootstep(StaticFunctionTag*, TESForm* form) {
 		if (!form) {
 			return;
 		}
-		auto event_manager = ModEventManager::GetSingleton();
-		event_manager.m_onfootstep.Unregister(form);
+		auto& event_manager = ModEventManager::GetSingleton();
+		if (event_manager.m_onfootstep.Unregister(form)) {
+			FootstepBus::OnPapyrusRegister(false);
+		}
 	}
 }
 
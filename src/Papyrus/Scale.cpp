@@ -1,4 +1,5 @@
 #include "Scale/Scale.hpp"
+#include "Scale/ScaleSnapshot.hpp"
 
 using namespace GTS;
 using namespace RE::BSScript;
@@ -6,6 +7,35 @@ using namespace RE::BSScript;
 namespace {
 	constexpr std::string_view PapyrusClass = "GTSScale";
 
+	// Getters registered as tasklets read the snapshot, setters stay on the main thread and refresh it.
+	// Natural scale isn't in the snapshot, its getters are frame-synced and read the live value
+
+	template <float ScaleValues::* Field>
+	std::vector<float> GetMany(const std::vector<Actor*>& actors) {
+		std::vector<float> result;
+		result.reserve(actors.size());
+		for (const auto& values : ScaleSnapshot::GetMany(actors)) {
+			result.push_back(values.*Field);
+		}
+		return result;
+	}
+
+	// A single value applies to every actor
+	template <class Setter>
+	void SetMany(const std::vector<Actor*>& actors, const std::vector<float>& values, Setter setter) {
+		if (values.empty() || (values.size() != 1 && values.size() != actors.size())) {
+			log::warn("Papyrus: {} values for {} actors", values.size(), actors.size());
+			return;
+		}
+		for (std::size_t i = 0; i < actors.size(); i++) {
+			if (!actors[i]) {
+				continue;
+			}
+			setter(actors[i], values.size() == 1 ? values[0] : values[i]);
+			ScaleSnapshot::Refresh(actors[i]);
+		}
+	}
+
 	bool SetScale(StaticFunctionTag*, Actor* actor, float scale) {
 		bool result = false;
 		auto actor_data = Persistent::GetSingleton().GetData(actor);
@@ -14,6 +44,7 @@ namespace {
 			actor_data->visual_scale = scale;
 			actor_data->visual_scale_v = 0.0f;
 			actor_data->target_scale = scale;
+			ScaleSnapshot::Refresh(actor);
 		}
 		return result;
 	}
@@ -35,6 +66,7 @@ namespace {
 			actor_data->visual_scale = scale;
 			actor_data->visual_scale_v = 0.0f;
 			actor_data->target_scale = scale;
+			ScaleSnapshot::Refresh(actor);
 		}
 		return result;
 	}
@@ -42,39 +74,85 @@ namespace {
 	// Target Scales
 	void SetTargetScale(StaticFunctionTag*, Actor* actor, float scale) {
 		set_target_scale(actor, scale);
+		ScaleSnapshot::Refresh(actor);
 	}
 
 	float GetTargetScale(StaticFunctionTag*, Actor* actor) {
-		return get_target_scale(actor);
+		return ScaleSnapshot::Get(actor).target;
 	}
 
 	void ModTargetScale(StaticFunctionTag*, Actor* actor, float amt) {
 		mod_target_scale(actor, amt);
+		ScaleSnapshot::Refresh(actor);
 	}
 
 	void SetMaxScale(StaticFunctionTag*, Actor* actor, float scale) {
 		set_max_scale(actor, scale);
+		ScaleSnapshot::Refresh(actor);
 	}
 
 	float GetMaxScale(StaticFunctionTag*, Actor* actor) {
-		return get_max_scale(actor); 
+		return ScaleSnapshot::Get(actor).max;
 	}
 
 	void ModMaxScale(StaticFunctionTag*, Actor* actor, float amt) {
 		mod_max_scale(actor, amt);
+		ScaleSnapshot::Refresh(actor);
 	}
 
 	float GetVisualScale(StaticFunctionTag*, Actor* actor) {
-		return get_visual_scale(actor);
+		return ScaleSnapshot::Get(actor).visual;
 	}
 
 	float GetGiantessScale(StaticFunctionTag*, Actor* actor) {
-		return get_giantess_scale(actor);
+		return ScaleSnapshot::Get(actor).giantess;
 	}
 
 	float GetNaturalScale(StaticFunctionTag*, Actor* actor) {
 		return get_natural_scale(actor, true);
 	}
+
+	// Bulk
+	std::vector<float> GetTargetScales(StaticFunctionTag*, std::vector<Actor*> actors) {
+		return GetMany<&ScaleValues::target>(actors);
+	}
+
+	std::vector<float> GetMaxScales(StaticFunctionTag*, std::vector<Actor*> actors) {
+		return GetMany<&ScaleValues::max>(actors);
+	}
+
+	std::vector<float> GetVisualScales(StaticFunctionTag*, std::vector<Actor*> actors) {
+		return GetMany<&ScaleValues::visual>(actors);
+	}
+
+	std::vector<float> GetGiantessScales(StaticFunctionTag*, std::vector<Actor*> actors) {
+		return GetMany<&ScaleValues::giantess>(actors);
+	}
+
+	std::vector<float> GetNaturalScales(StaticFunctionTag*, std::vector<Actor*> actors) {
+		std::vector<float> result;
+		result.reserve(actors.size());
+		for (auto actor : actors) {
+			result.push_back(get_natural_scale(actor, true));
+		}
+		return result;
+	}
+
+	void SetTargetScales(StaticFunctionTag*, std::vector<Actor*> actors, std::vector<float> scales) {
+		SetMany(actors, scales, [](Actor* actor, float value) { set_target_scale(actor, value); });
+	}
+
+	void ModTargetScales(StaticFunctionTag*, std::vector<Actor*> actors, std::vector<float> amounts) {
+		SetMany(actors, amounts, [](Actor* actor, float value) { mod_target_scale(actor, value); });
+	}
+
+	void SetMaxScales(StaticFunctionTag*, std::vector<Actor*> actors, std::vector<float> scales) {
+		SetMany(actors, scales, [](Actor* actor, float value) { set_max_scale(actor, value); });
+	}
+
+	void ModMaxScales(StaticFunctionTag*, std::vector<Actor*> actors, std::vector<float> amounts) {
+		SetMany(actors, amounts, [](Actor* actor, float value) { mod_max_scale(actor, value); });
+	}
 }
 
 namespace GTS {
@@ -87,23 +165,34 @@ namespace GTS {
 
 		//Target Scale
 		vm->RegisterFunction("SetTargetScale", PapyrusClass, SetTargetScale);
-		vm->RegisterFunction("GetTargetScale", PapyrusClass, GetTargetScale);
+		vm->RegisterFunction("GetTargetScale", PapyrusClass, GetTargetScale, true);
 		vm->RegisterFunction("ModTargetScale", PapyrusClass, ModTargetScale);
 
 		//Max Scale
 		vm->RegisterFunction("SetMaxScale", PapyrusClass, SetMaxScale);
-		vm->RegisterFunction("GetMaxScale", PapyrusClass, GetMaxScale);
+		vm->RegisterFunction("GetMaxScale", PapyrusClass, GetMaxScale, true);
 		vm->RegisterFunction("ModMaxScale", PapyrusClass, ModMaxScale);
 
 		//Visual Scale
-		vm->RegisterFunction("GetVisualScale", PapyrusClass, GetVisualScale);
+		vm->RegisterFunction("GetVisualScale", PapyrusClass, GetVisualScale, true);
 
 		//Gts Scale
-		vm->RegisterFunction("GetGiantessScale", PapyrusClass, GetGiantessScale);
+		vm->RegisterFunction("GetGiantessScale", PapyrusClass, GetGiantessScale, true);
 
 		//Natural Scale
 		vm->RegisterFunction("GetNaturalScale", PapyrusClass, GetNaturalScale);
 
+		//Bulk, one call for a whole array of actors
+		vm->RegisterFunction("GetTargetScales", PapyrusClass, GetTargetScales, true);
+		vm->RegisterFunction("GetMaxScales", PapyrusClass, GetMaxScales, true);
+		vm->RegisterFunction("GetVisualScales", PapyrusClass, GetVisualScales, true);
+		vm->RegisterFunction("GetGiantessScales", PapyrusClass, GetGiantessScales, true);
+		vm->RegisterFunction("GetNaturalScales", PapyrusClass, GetNaturalScales);
+		vm->RegisterFunction("SetTargetScales", PapyrusClass, SetTargetScales);
+		vm->RegisterFunction("ModTargetScales", PapyrusClass, ModTargetScales);
+		vm->RegisterFunction("SetMaxScales", PapyrusClass, SetMaxScales);
+		vm->RegisterFunction("ModMaxScales", PapyrusClass, ModMaxScales);
+
 		return true;
 	}
 }
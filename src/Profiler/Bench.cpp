@@ -0,0 +1,36 @@
+#include "Profiler/Bench.hpp"
+#include "Managers/Console/ConsoleManager.hpp"
+
+namespace {
+
+	std::vector<std::pair<std::string, void (*)()>>& Registered() {
+		static std::vector<std::pair<std::string, void (*)()>> benches;
+		return benches;
+	}
+}
+
+namespace GTS::Bench {
+
+	void Register(std::string_view a_name, void (*a_run)(), const std::string& a_desc) {
+		std::string name = std::format("bench{}", a_name);
+		ConsoleManager::RegisterCommand(name, a_run, a_desc);
+		auto& benches = Registered();
+		// DataReady runs once, but don't run a benchmark twice if it ever runs again
+		if (std::ranges::find(benches, name, &std::pair<std::string, void (*)()>::first) == benches.end()) {
+			benches.emplace_back(std::move(name), a_run);
+		}
+	}
+
+	const std::vector<std::pair<std::string, void (*)()>>& GetAll() {
+		return Registered();
+	}
+
+	std::vector<Actor*> LoadedActors() {
+		auto actors = find_actors();
+		std::erase(actors, nullptr);
+		if (actors.empty()) {
+			Cprint("No loaded actors");
+		}
+		return actors;
+	}
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+// Shared scaffolding for the bench* console commands
+//
+// Each benchmark registers itself with Bench::Register, which names the command and lets benchsuite find it,
+// and times its passes with Bench::TimeUs.
+
+namespace GTS::Bench {
+
+	// Registers "bench" + a_name as a console command and adds it to benchsuite
+	void Register(std::string_view a_name, void (*a_run)(), const std::string& a_desc);
+
+	// Every registered benchmark as {command name, function}, in registration order
+	[[nodiscard]] const std::vector<std::pair<std::string, void (*)()>>& GetAll();
+
+	// Microseconds a_rounds calls of a_pass take
+	template <class Pass>
+	[[nodiscard]] double TimeUs(std::size_t a_rounds, Pass&& a_pass) {
+		const auto start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i < a_rounds; i++) {
+			a_pass();
+		}
+		return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// Loaded actors, prints a note when there are none so the caller can just return
+	[[nodiscard]] std::vector<Actor*> LoadedActors();
+}
@@ -0,0 +1,102 @@
+#include "Profiler/FrameBenchmark.hpp"
+#include "Managers/Console/ConsoleManager.hpp"
+#include "Profiler/Bench.hpp"
+
+namespace {
+
+	constexpr std::uint32_t DefaultFrames = 600;
+
+	void CMD_BenchmarkFrame() {
+		GTS::FrameBenchmark::Start(DefaultFrames);
+	}
+
+	void CMD_BenchmarkSuite() {
+		GTS::FrameBenchmark::RunSuite();
+	}
+}
+
+namespace GTS {
+
+	FrameBenchmark& FrameBenchmark::GetSingleton() noexcept {
+		static FrameBenchmark instance;
+		return instance;
+	}
+
+	std::string FrameBenchmark::DebugName() {
+		return "::FrameBenchmark";
+	}
+
+	void FrameBenchmark::DataReady() {
+		ConsoleManager::RegisterCommand("benchframe", CMD_BenchmarkFrame, "Time every update listener over the next 600 frames, per loaded actor");
+		ConsoleManager::RegisterCommand("benchsuite", CMD_BenchmarkSuite, "Run every bench command, then benchframe");
+	}
+
+	void FrameBenchmark::Start(std::uint32_t frames) {
+		auto& me = GetSingleton();
+		me.samples.clear();
+		me.framesLeft = frames;
+		me.frames = 0;
+		me.actorFrames = 0;
+		Recording.store(true, std::memory_order_relaxed);
+		Cprint("Recording the next {} frames, keep playing normally", frames);
+	}
+
+	void FrameBenchmark::RunSuite() {
+		for (const auto& [name, run] : Bench::GetAll()) {
+			Cprint("=== {} ===", name);
+			log::info("FrameBenchmark: Running {}", name);
+			run();
+		}
+		Start(DefaultFrames);
+	}
+
+	void FrameBenchmark::AddSample(EventListener* listener, std::chrono::nanoseconds time) {
+		auto& sample = GetSingleton().samples[listener];
+		const auto ns = static_cast<std::uint64_t>(time.count());
+		sample.totalNs += ns;
+		sample.worstNs = std::max(sample.worstNs, ns);
+	}
+
+	void FrameBenchmark::EndFrame() {
+		auto& me = GetSingleton();
+		me.frames += 1;
+		me.actorFrames += std::max<std::size_t>(find_actors().size(), 1);
+		if (me.framesLeft > 0) {
+			me.framesLeft -= 1;
+		}
+		if (me.framesLeft == 0) {
+			Recording.store(false, std::memory_order_relaxed);
+			me.Report();
+		}
+	}
+
+	void FrameBenchmark::Report() {
+		std::vector<std::pair<EventListener*, Sample>> sorted(this->samples.begin(), this->samples.end());
+		std::ranges::sort(sorted, std::greater {}, [](const auto& entry) {
+			return entry.second.totalNs;
+		});
+
+		std::uint64_t total = 0;
+		for (const auto& [listener, sample] : sorted) {
+			total += sample.totalNs;
+		}
+
+		const double actorFrames = static_cast<double>(std::max<std::uint64_t>(this->actorFrames, 1));
+		const double frames = static_cast<double>(std::max<std::uint32_t>(this->frames, 1));
+
+		Cprint("--- Frame Benchmark ({} frames, {:.1f} actors on average) ---", this->frames, actorFrames / frames);
+		Cprint("All listeners: {:.0f} ns/actor/frame, {:.1f} us/frame", total / actorFrames, total / frames / 1000.0);
+		// Console only fits so much, the log gets all of them
+		constexpr std::size_t Shown = 12;
+		for (std::size_t i = 0; i < sorted.size(); i++) {
+			const auto& [listener, sample] = sorted[i];
+			const double perActor = sample.totalNs / actorFrames;
+			const double worst = sample.worstNs / 1000.0;
+			if (i < Shown) {
+				Cprint("{}: {:.0f} ns/actor/frame, worst frame {:.1f} us", listener->DebugName(), perActor, worst);
+			}
+			log::info("FrameBenchmark: {} {:.0f} ns/actor/frame, worst frame {:.1f} us", listener->DebugName(), perActor, worst);
+		}
+		this->samples.clear();
+	}
+}
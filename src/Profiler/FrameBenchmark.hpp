@@ -0,0 +1,43 @@
+#pragma once
+
+// In game benchmark suite
+//
+// "benchframe" times every listener's Update over the next frames of normal play and reports it per loaded actor,
+// "benchsuite" runs all bench* micro benchmarks and then starts benchframe.
+// Measures the real update loop, so nothing gets called more often than it would be anyway.
+
+namespace GTS {
+
+	class FrameBenchmark : public EventListener {
+		public:
+			[[nodiscard]] static FrameBenchmark& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void DataReady() override;
+
+			[[nodiscard]] static bool IsRecording() {
+				return Recording.load(std::memory_order_relaxed);
+			}
+			// EventDispatcher::DoUpdate calls these while recording
+			static void AddSample(EventListener* listener, std::chrono::nanoseconds time);
+			static void EndFrame();
+
+			static void Start(std::uint32_t frames);
+			static void RunSuite();
+
+		private:
+			void Report();
+
+			struct Sample {
+				std::uint64_t totalNs = 0;
+				std::uint64_t worstNs = 0;
+			};
+
+			static inline std::atomic<bool> Recording = false;
+
+			std::unordered_map<EventListener*, Sample> samples;
+			std::uint32_t framesLeft = 0;
+			std::uint32_t frames = 0;
+			std::uint64_t actorFrames = 0;
+	};
+}
@@ -406,6 +406,8 @@ namespace GTS {
 		ImGui::Text("Total DLL Time: %.3fms", sTotal * 1000);
 		ImGui::SameLine(); ImGui::Text("FPS: %.2f", ImGui::GetIO().Framerate);
 		ImGui::SameLine(); ImGui::Text("Loaded Actors: %d", GtsManager::LoadedActorCount);
+		ImGui::SameLine(); ImGui::Text("Scale Reads: %d", GtsManager::ScaleReadsLastFrame);
+		ImGui::SameLine(); ImGui::Text("Scale Writes: %d", GtsManager::ScaleWritesLastFrame);
 		ImGui::SameLine(); ImGui::Text("Threads: %zu", Instance.thread_data.size());
 
 		// Settings popup
@@ -154,6 +154,7 @@ namespace GTS {
 
 					auto& initScale = GetActorInitialScales(giantref);
 					initScale.model = 1.0f * giantref->GetScale();
+					MarkScaleDirty(giantref);
 				}
 			});
 		}
@@ -168,6 +169,7 @@ namespace GTS {
 		if (fabs(refScale - target_scale) > 1e-5) {
 			actor->GetReferenceRuntimeData().refScale = static_cast<std::uint16_t>(target_scale * 100.0F);
 			actor->DoReset3D(false);
+			MarkScaleDirty(actor);
 		}
 	}
 
@@ -194,7 +196,10 @@ namespace GTS {
 			first_model->local.scale = target_scale;
 			update_node(first_model);
 		}
-		
+
+		if (result) {
+			MarkScaleDirty(actor);
+		}
 		return result;
 	}
 
@@ -218,6 +223,10 @@ namespace GTS {
 			first_node->local.scale = target_scale;
 			update_node(first_node);
 		}
+
+		if (result) {
+			MarkScaleDirty(actor);
+		}
 		return result;
 	}
 
@@ -304,4 +313,10 @@ namespace GTS {
 	bool update_model_visuals(Actor* actor, float scale) {
 		return set_model_scale(actor, scale);
 	}
+
+	void MarkScaleDirty(Actor* actor) {
+		if (auto data = Transient::GetSingleton().GetData(actor)) {
+			data->ScaleDirty = true;
+		}
+	}
 }
@@ -33,4 +33,8 @@ namespace GTS {
 	float game_get_scale_overrides(Actor& actor);
 	
 	bool update_model_visuals(Actor* actor, float scale);
+
+	// Makes apply_height re-read the model, initial and SetScale values of the actor on the next update.
+	// Call after anything that can change them outside of apply_height
+	void MarkScaleDirty(Actor* actor);
 }
@@ -1,4 +1,5 @@
 #include "Scale/Scale.hpp"
+#include "Scale/SizeCache.hpp"
 
 namespace {
 	constexpr float EPS = std::numeric_limits<float>::epsilon();
@@ -22,6 +23,7 @@ namespace GTS {
 			} else {
 				// If we are over max: forbid it
 			}
+			SizeCache::Invalidate(&actor);
 		}
 	}
 
@@ -68,6 +70,7 @@ namespace GTS {
                 set_target_scale(actor, max_scale);
             } else { // if we are over max then forbid it
             }
+            SizeCache::Invalidate(&actor);
         }
     }
 
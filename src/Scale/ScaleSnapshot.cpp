@@ -0,0 +1,197 @@
+#include "Scale/ScaleSnapshot.hpp"
+#include "Managers/Console/ConsoleManager.hpp"
+#include "Profiler/Bench.hpp"
+
+namespace {
+
+	// Saved actors added to the snapshot per frame after a load
+	constexpr std::size_t SeedsPerFrame = 32;
+}
+
+namespace GTS {
+
+	ScaleSnapshot& ScaleSnapshot::GetSingleton() noexcept {
+		static ScaleSnapshot instance;
+		return instance;
+	}
+
+	std::string ScaleSnapshot::DebugName() {
+		return "::ScaleSnapshot";
+	}
+
+	void ScaleSnapshot::DataReady() {
+		Bench::Register("scales", Benchmark, "Check the Papyrus scale snapshot against live values and time both");
+	}
+
+	void ScaleSnapshot::Update() {
+		GTS_PROFILE_SCOPE("ScaleSnapshot: Update");
+
+		if (!this->seeded) {
+			// Answers unloaded actors with saved scales too, Persistent has loaded by the first update
+			this->seeding = Persistent::GetSingleton().GetActorDataIds();
+			this->seeded = true;
+		}
+
+		std::vector<std::pair<FormID, ScaleValues>> fresh;
+		for (auto actor : find_actors()) {
+			if (actor) {
+				this->RefreshIfChanged(actor, fresh);
+			}
+		}
+		for (FormID id : this->table.TakeRequests()) {
+			if (auto actor = TESForm::LookupByID<Actor>(id)) {
+				this->RefreshIfChanged(actor, fresh);
+			}
+		}
+		// Saved actors a few per frame, so a save with thousands of them doesn't stall the first frame
+		const std::size_t seeds = std::min(this->seeding.size(), SeedsPerFrame);
+		for (std::size_t i = 0; i < seeds; i++) {
+			if (auto actor = TESForm::LookupByID<Actor>(this->seeding.back())) {
+				this->RefreshIfChanged(actor, fresh);
+			}
+			this->seeding.pop_back();
+		}
+		this->table.Store(fresh);
+
+		// Unloaded actors stay, their scales don't change until they load again
+		static PeriodicPrune Prune;
+		auto gone = [](FormID id) {
+			return TESForm::LookupByID<Actor>(id) == nullptr;
+		};
+		if (Prune(this->stored, [&gone](const auto& entry) { return gone(entry.first); })) {
+			this->table.EraseIf(gone);
+		}
+	}
+
+	void ScaleSnapshot::RefreshIfChanged(Actor* actor, std::vector<std::pair<FormID, ScaleValues>>& fresh) {
+		const Inputs inputs = ReadInputs(actor);
+		auto [found, inserted] = this->stored.try_emplace(actor->formID, inputs);
+		if (!inserted) {
+			if (found->second == inputs) {
+				return;
+			}
+			found->second = inputs;
+		}
+		fresh.emplace_back(actor->formID, Compute(actor));
+	}
+
+	ScaleSnapshot::Inputs ScaleSnapshot::ReadInputs(Actor* actor) {
+		Inputs inputs { .refScale = actor->GetReferenceRuntimeData().refScale };
+		if (auto data = Persistent::GetSingleton().GetData(actor)) {
+			inputs.hasData = true;
+			inputs.target = data->target_scale;
+			inputs.max = data->max_scale;
+			inputs.visual = data->visual_scale;
+		}
+		// Natural scale, a race switch marks the actor dirty and apply_height picks up the new initial scale
+		if (auto data = Transient::GetSingleton().GetData(actor)) {
+			inputs.otherScales = data->OtherScales;
+			inputs.initialScale = data->AppliedInitialScale;
+		}
+		return inputs;
+	}
+
+	void ScaleSnapshot::Reset() {
+		this->table.Clear();
+		this->stored.clear();
+		this->seeding.clear();
+		this->seeded = false;
+	}
+
+	void ScaleSnapshot::ResetActor(Actor* actor) {
+		if (!actor) {
+			return;
+		}
+		this->table.Erase(actor->formID);
+		this->stored.erase(actor->formID);
+	}
+
+	ScaleValues ScaleSnapshot::Miss(FormID id) {
+		if (OnMainUpdateThread()) {
+			if (auto actor = TESForm::LookupByID<Actor>(id)) {
+				return Compute(actor);
+			}
+			return {};
+		}
+		GetSingleton().table.Request(id);
+		return {};
+	}
+
+	ScaleValues ScaleSnapshot::Get(Actor* actor) {
+		return GetSingleton().table.Get(actor ? actor->formID : 0, Miss);
+	}
+
+	std::vector<ScaleValues> ScaleSnapshot::GetMany(std::span<Actor* const> actors) {
+		std::vector<FormID> ids;
+		ids.reserve(actors.size());
+		for (auto actor : actors) {
+			ids.push_back(actor ? actor->formID : 0);
+		}
+		return GetSingleton().table.GetMany(ids, Miss);
+	}
+
+	void ScaleSnapshot::Refresh(Actor* actor) {
+		if (!actor || !OnMainUpdateThread()) {
+			return;
+		}
+		auto& me = GetSingleton();
+		const std::pair<FormID, ScaleValues> values { actor->formID, Compute(actor) };
+		me.stored.insert_or_assign(actor->formID, ReadInputs(actor));
+		me.table.Store(std::span(&values, 1));
+	}
+
+	ScaleValues ScaleSnapshot::Compute(Actor* actor) {
+		return ScaleValues {
+			.target = get_target_scale(actor),
+			.max = get_max_scale(actor),
+			.visual = get_visual_scale(actor),
+			.giantess = get_giantess_scale(actor),
+		};
+	}
+
+	void ScaleSnapshot::Benchmark() {
+		constexpr std::size_t Rounds = 1000;
+
+		const auto actors = Bench::LoadedActors();
+		if (actors.empty()) {
+			return;
+		}
+
+		// Bulk must always give what the single actor getter gives, live can be a frame ahead for actors still growing
+		std::size_t bulkMismatches = 0;
+		std::size_t liveMismatches = 0;
+		const auto bulk = GetMany(actors);
+		for (std::size_t i = 0; i < actors.size(); i++) {
+			const ScaleValues single = Get(actors[i]);
+			const ScaleValues live = Compute(actors[i]);
+			if (bulk[i] != single) {
+				bulkMismatches += 1;
+				log::warn("ScaleSnapshot: bulk and single differ for {}, visual {} vs {}", actors[i]->GetDisplayFullName(), bulk[i].visual, single.visual);
+			}
+			if (single != live) {
+				liveMismatches += 1;
+				log::info("ScaleSnapshot: {} is behind live, visual {} vs {}, target {} vs {}", actors[i]->GetDisplayFullName(), single.visual, live.visual, single.target, live.target);
+			}
+		}
+
+		float sink = 0.0f;
+		const double live = Bench::TimeUs(Rounds, [&]() {
+			for (auto actor : actors) {
+				sink += Compute(actor).visual;
+			}
+		});
+		const double cached = Bench::TimeUs(Rounds, [&]() {
+			for (auto actor : actors) {
+				sink += Get(actor).visual;
+			}
+		});
+		const double many = Bench::TimeUs(Rounds, [&]() {
+			sink += GetMany(actors)[0].visual;
+		});
+
+		Cprint("--- Scale Snapshot ({} actors x {}) ---", actors.size(), Rounds);
+		Cprint("Live: {:.0f} us, Snapshot: {:.0f} us, Bulk: {:.0f} us", live, cached, many);
+		Cprint("Bulk differs from single for {} actors, {} actors are a frame behind live", bulkMismatches, liveMismatches);
+		log::trace("Scale benchmark sink {}", sink);
+	}
+}
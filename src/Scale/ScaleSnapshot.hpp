@@ -0,0 +1,61 @@
+#pragma once
+#include "Scale/ScaleTable.hpp"
+
+// Thread safe copy of every actor's target, max, visual and giantess scale for Papyrus
+//
+// Those getters are registered as callable from tasklets, so scripts calling them don't wait for the next frame.
+// They run on VM threads and can't read Persistent/Transient directly, this snapshot is refreshed on the main thread instead:
+// loaded actors whose scale inputs changed every frame, everyone with saved scale data a few at a time after a load,
+// and actors written to by Papyrus right away. Natural scale and heights are not in here, their getters are frame-synced
+// and read the live values.
+
+namespace GTS {
+
+	class ScaleSnapshot : public EventListener {
+		public:
+			[[nodiscard]] static ScaleSnapshot& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void DataReady() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+			virtual void ResetActor(Actor* actor) override;
+
+			// Any thread. On the main thread a miss is calculated on the spot, elsewhere it picks the actor up next frame
+			// and answers ScaleValues{}, all 1.0, which is what an actor without saved scale data has
+			static ScaleValues Get(Actor* actor);
+			// Same as Get for each actor, under one lock
+			static std::vector<ScaleValues> GetMany(std::span<Actor* const> actors);
+			// Main thread, call after writing an actor's scale so tasklets see it before the next frame
+			static void Refresh(Actor* actor);
+
+			static ScaleValues Compute(Actor* actor);
+
+			static void Benchmark();
+
+		private:
+			// Everything Compute depends on, read without touching the model
+			struct Inputs {
+				bool hasData = false;
+				float target = 0.0f;
+				float max = 0.0f;
+				float visual = 0.0f;
+				float otherScales = 0.0f;
+				float initialScale = 0.0f;
+				std::uint16_t refScale = 0;
+
+				bool operator==(const Inputs&) const = default;
+			};
+
+			static Inputs ReadInputs(Actor* actor);
+			static ScaleValues Miss(FormID id);
+			// Adds the actor's values to fresh when its inputs changed since they were last stored
+			void RefreshIfChanged(Actor* actor, std::vector<std::pair<FormID, ScaleValues>>& fresh);
+
+			ScaleTable table;
+			// Main thread only
+			std::unordered_map<FormID, Inputs> stored;
+			std::vector<FormID> seeding;
+			bool seeded = false;
+	};
+}
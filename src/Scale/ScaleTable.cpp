@@ -0,0 +1,90 @@
+#include "Scale/ScaleTable.hpp"
+
+namespace GTS {
+
+	ScaleValues ScaleTable::Get(FormID a_id, const MissFunction& a_miss) const {
+		if (a_id == 0) {
+			return {};
+		}
+		{
+			std::shared_lock guard(this->lock);
+			auto found = this->entries.find(a_id);
+			if (found != this->entries.end()) {
+				return found->second;
+			}
+		}
+		return a_miss(a_id);
+	}
+
+	std::vector<ScaleValues> ScaleTable::GetMany(std::span<const FormID> a_ids, const MissFunction& a_miss) const {
+		std::vector<ScaleValues> result(a_ids.size());
+		std::vector<std::size_t> missing;
+		{
+			std::shared_lock guard(this->lock);
+			for (std::size_t i = 0; i < a_ids.size(); i++) {
+				if (a_ids[i] == 0) {
+					continue;
+				}
+				auto found = this->entries.find(a_ids[i]);
+				if (found != this->entries.end()) {
+					result[i] = found->second;
+				}
+				else {
+					missing.push_back(i);
+				}
+			}
+		}
+		// The miss function may take the lock itself
+		for (std::size_t i : missing) {
+			result[i] = a_miss(a_ids[i]);
+		}
+		return result;
+	}
+
+	void ScaleTable::Store(std::span<const std::pair<FormID, ScaleValues>> a_values) {
+		if (a_values.empty()) {
+			return;
+		}
+		std::unique_lock guard(this->lock);
+		for (const auto& [id, values] : a_values) {
+			this->entries.insert_or_assign(id, values);
+		}
+	}
+
+	void ScaleTable::Erase(FormID a_id) {
+		std::unique_lock guard(this->lock);
+		this->entries.erase(a_id);
+	}
+
+	void ScaleTable::Clear() {
+		std::unique_lock guard(this->lock);
+		this->entries.clear();
+		this->requested.clear();
+	}
+
+	void ScaleTable::EraseIf(const std::function<bool(FormID id)>& a_stale) {
+		std::unique_lock guard(this->lock);
+		std::erase_if(this->entries, [&a_stale](const auto& entry) {
+			return a_stale(entry.first);
+		});
+	}
+
+	std::size_t ScaleTable::Size() const {
+		std::shared_lock guard(this->lock);
+		return this->entries.size();
+	}
+
+	void ScaleTable::Request(FormID a_id) {
+		std::unique_lock guard(this->lock);
+		if (std::ranges::find(this->requested, a_id) == this->requested.end()) {
+			this->requested.push_back(a_id);
+		}
+	}
+
+	std::vector<FormID> ScaleTable::TakeRequests() {
+		std::vector<FormID> result;
+		std::unique_lock guard(this->lock);
+		result.swap(this->requested);
+		return result;
+	}
+}
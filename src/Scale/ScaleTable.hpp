@@ -0,0 +1,43 @@
+#pragma once
+
+// Storage behind ScaleSnapshot, a FormID keyed table of scale values behind a shared_mutex
+//
+// Holds nothing from the game so the single and bulk lookups can be tested on their own.
+// A miss is handed to the caller's miss function, which decides what to answer.
+
+namespace GTS {
+
+	struct ScaleValues {
+		float target = 1.0f;   // get_target_scale
+		float max = 1.0f;      // get_max_scale
+		float visual = 1.0f;   // get_visual_scale
+		float giantess = 1.0f; // get_giantess_scale
+
+		bool operator==(const ScaleValues&) const = default;
+	};
+
+	class ScaleTable {
+		public:
+			using MissFunction = std::function<ScaleValues(FormID id)>;
+
+			// Stored values of id, a_miss(id) when there are none. Id 0 (no actor) answers ScaleValues{}
+			[[nodiscard]] ScaleValues Get(FormID a_id, const MissFunction& a_miss) const;
+			// Same as Get for each id, the hits under one lock, the misses after it in order
+			[[nodiscard]] std::vector<ScaleValues> GetMany(std::span<const FormID> a_ids, const MissFunction& a_miss) const;
+
+			void Store(std::span<const std::pair<FormID, ScaleValues>> a_values);
+			void Erase(FormID a_id);
+			void Clear();
+			void EraseIf(const std::function<bool(FormID id)>& a_stale);
+			[[nodiscard]] std::size_t Size() const;
+
+			// Ids a miss function asked to have stored, each once until taken
+			void Request(FormID a_id);
+			[[nodiscard]] std::vector<FormID> TakeRequests();
+
+		private:
+			std::unordered_map<FormID, ScaleValues> entries;
+			std::vector<FormID> requested;
+			mutable std::shared_mutex lock;
+	};
+}
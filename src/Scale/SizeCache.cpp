@@ -0,0 +1,82 @@
+#include "Scale/SizeCache.hpp"
+
+#include "Managers/HighHeel.hpp"
+
+namespace {
+
+	constexpr std::uint64_t InvalidFrame = std::numeric_limits<std::uint64_t>::max();
+}
+
+namespace GTS {
+
+	SizeCache& SizeCache::GetSingleton() noexcept {
+		static SizeCache instance;
+		return instance;
+	}
+
+	std::string SizeCache::DebugName() {
+		return "::SizeCache";
+	}
+
+	void SizeCache::Update() {
+		// Drop actors that weren't queried recently so unloaded actors don't pile up
+		static PeriodicPrune Prune;
+		const std::uint64_t frame = Time::FramesElapsed();
+		Prune(this->entries, [frame](const auto& entry) {
+			return entry.second.frame == InvalidFrame || entry.second.frame + 1 < frame;
+		});
+	}
+
+	void SizeCache::Reset() {
+		this->entries.clear();
+	}
+
+	void SizeCache::ResetActor(Actor* actor) {
+		Invalidate(actor);
+	}
+
+	void SizeCache::OnHighheelEquip(const HighheelEquip& evt) {
+		Invalidate(evt.actor);
+	}
+
+	SizeComponents SizeCache::Get(Actor* actor) {
+		if (!actor) {
+			return {};
+		}
+		if (!OnMainUpdateThread()) {
+			return Compute(actor);
+		}
+
+		auto& me = GetSingleton();
+		const std::uint64_t frame = Time::FramesElapsed();
+		auto& entry = me.entries[actor->formID];
+		if (entry.frame != frame) {
+			entry.components = Compute(actor);
+			entry.frame = frame;
+		}
+		return entry.components;
+	}
+
+	void SizeCache::Invalidate(Actor* actor) {
+		if (!actor || !OnMainUpdateThread()) {
+			return;
+		}
+		auto& me = GetSingleton();
+		auto it = me.entries.find(actor->formID);
+		if (it != me.entries.end()) {
+			it->second.frame = InvalidFrame;
+		}
+	}
+
+	SizeComponents SizeCache::Compute(Actor* actor) {
+		GTS_PROFILE_SCOPE("SizeCache: Compute");
+		return SizeComponents {
+			.visual = get_visual_scale(actor),
+			.target = get_target_scale(actor),
+			.giantess = get_giantess_scale(actor),
+			.bbMult = GetSizeFromBoundingBox(actor),
+			.hhOffset = HighHeelManager::GetHHOffset(actor)[2] * 0.01f,
+			.smt = HasSMT(actor),
+		};
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+// Per-frame cache of the size components used in size difference checks
+//
+// GetSizeDifference is queried for the same giant/tiny pairs many times per frame (damage, vore, AI, havok filter).
+// Each actor's components are computed once per frame, pairwise differences then become two lookups and a divide.
+
+namespace GTS {
+
+	struct SizeComponents {
+		float visual = 1.0f;   // get_visual_scale
+		float target = 1.0f;   // get_target_scale
+		float giantess = 1.0f; // get_giantess_scale
+		float bbMult = 1.0f;   // GetSizeFromBoundingBox
+		float hhOffset = 0.0f; // Scaled HH .z offset in game scale units (GetHHOffset()[2] * 0.01)
+		bool smt = false;      // Tiny Calamity active
+	};
+
+	class SizeCache : public EventListener {
+		public:
+			[[nodiscard]] static SizeCache& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+			virtual void ResetActor(Actor* actor) override;
+			virtual void OnHighheelEquip(const HighheelEquip& evt) override;
+
+			// Off the main update thread this computes the components without touching the cache
+			static SizeComponents Get(Actor* actor);
+			// Call after writing to an actor's scale so later queries in the same frame see the new value
+			static void Invalidate(Actor* actor);
+
+		private:
+			struct Entry {
+				SizeComponents components;
+				std::uint64_t frame = std::numeric_limits<std::uint64_t>::max();
+			};
+
+			static SizeComponents Compute(Actor* actor);
+
+			std::unordered_map<FormID, Entry> entries;
+	};
+}
@@ -92,6 +92,18 @@ namespace GTS {
 	            ImGui::Spacing();
 	        }
 	    }
+
+        ImUtil_Unique {
+
+            const char* T0 = "How many times per second PapyrusUpdate work runs.\n"
+                             "0 runs it whenever any script receives OnUpdate, which depends on the load order.";
+
+            if (ImGui::CollapsingHeader("Performance")) {
+                ImUtil::SliderF("Papyrus Update Rate", &Settings.fPapyrusUpdateRate, 0.0f, 60.0f, T0, "%.0f/s");
+
+                ImGui::Spacing();
+            }
+        }
     }
 
     void CategoryAdvanced::DrawRight() {
@@ -244,6 +256,12 @@ namespace GTS {
 
                 ImGui::SameLine();
 
+                if (ImUtil::Button("Compact", "Evict stale or default valued actor data now. This also runs in the background.", false, 1.0f)) {
+                    DataCompactor::CompactNow();
+                }
+
+                ImGui::SameLine();
+
                 ImGui::TextColored(ImUtil::ColorError, "Info (!)");
                 ImUtil::Tooltip(THelp, true);
 
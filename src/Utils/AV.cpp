@@ -1,9 +1,18 @@
 #include "Utils/AV.hpp"
 #include "Config/Config.hpp"
 
+namespace {
+	std::atomic<std::uint64_t> EngineAVCalls = 0;
+
+	void CountEngineAVCalls(std::uint64_t a_count) {
+		EngineAVCalls.fetch_add(a_count, std::memory_order_relaxed);
+	}
+}
+
 namespace GTS {
 
 	float GetMaxAV(Actor* actor, ActorValue av) {
+		CountEngineAVCalls(3);
 		auto baseValue = actor->AsActorValueOwner()->GetBaseActorValue(av);
 		auto permMod = actor->GetActorValueModifier(ACTOR_VALUE_MODIFIERS::kPermanent, av);
 		auto tempMod = actor->GetActorValueModifier(ACTOR_VALUE_MODIFIERS::kTemporary, av);
@@ -12,10 +21,12 @@ namespace GTS {
 	float GetAV(Actor* actor, ActorValue av) {
 		// actor->GetActorValue(av); returns a cached value so we calc directly from mods
 		float max_av = GetMaxAV(actor, av);
+		CountEngineAVCalls(1);
 		auto damageMod = actor->GetActorValueModifier(ACTOR_VALUE_MODIFIERS::kDamage, av);
 		return max_av + damageMod;
 	}
 	void ModAV(Actor* actor, ActorValue av, float amount) {
+		CountEngineAVCalls(1);
 		actor->AsActorValueOwner()->RestoreActorValue(RE::ACTOR_VALUE_MODIFIER::kTemporary, av, amount);
 	}
 	void SetAV(Actor* actor, ActorValue av, float amount) {
@@ -33,6 +44,7 @@ namespace GTS {
 			return;
 		}
 
+		CountEngineAVCalls(1);
 		actor->AsActorValueOwner()->RestoreActorValue(RE::ACTOR_VALUE_MODIFIER::kDamage, av, -amount);
 	}
 
@@ -46,6 +58,7 @@ namespace GTS {
 		float percentage = currentValue/maxValue;
 		float targetValue = target * maxValue;
 		float delta = targetValue - currentValue;
+		CountEngineAVCalls(1);
 		actor->AsActorValueOwner()->RestoreActorValue(ACTOR_VALUE_MODIFIER::kDamage, av, delta);
 	}
 
@@ -74,4 +87,7 @@ namespace GTS {
 		SetPercentageAV(actor, ActorValue::kMagicka, target);
 	}
 
+	std::uint64_t GetEngineAVCallCount() {
+		return EngineAVCalls.load(std::memory_order_relaxed);
+	}
 }
@@ -25,4 +25,7 @@ namespace GTS {
 
 	void SetMagickaPercentage(Actor* actor, float target);
 
+	// Running count of ActorValueOwner reads/writes made through the helpers above, for profiling
+	std::uint64_t GetEngineAVCallCount();
+
 }
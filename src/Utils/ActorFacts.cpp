@@ -0,0 +1,197 @@
+#include "Utils/ActorFacts.hpp"
+#include "Managers/Console/ConsoleManager.hpp"
+#include "Profiler/Bench.hpp"
+
+namespace {
+
+	constexpr std::uint64_t InvalidFrame = std::numeric_limits<std::uint64_t>::max();
+
+	void CMD_ValidateFacts() {
+		GTS::ActorFacts::ToggleValidation();
+	}
+}
+
+namespace GTS {
+
+	ActorFacts& ActorFacts::GetSingleton() noexcept {
+		static ActorFacts instance;
+		return instance;
+	}
+
+	std::string ActorFacts::DebugName() {
+		return "::ActorFacts";
+	}
+
+	void ActorFacts::DataReady() {
+		ConsoleManager::RegisterCommand("validatefacts", CMD_ValidateFacts, "Toggle cross-checking cached actor facts against live engine values");
+		Bench::Register("facts", Benchmark, "Time actor fact helpers with and without the per-frame cache");
+	}
+
+	void ActorFacts::Update() {
+		// Drop actors that weren't queried recently so unloaded actors don't pile up
+		static PeriodicPrune Prune;
+		const std::uint64_t frame = Time::FramesElapsed();
+		Prune(this->entries, [frame](const auto& entry) {
+			return entry.second.frame == InvalidFrame || entry.second.frame + 1 < frame;
+		});
+	}
+
+	void ActorFacts::Reset() {
+		this->entries.clear();
+	}
+
+	void ActorFacts::ResetActor(Actor* actor) {
+		Invalidate(actor);
+	}
+
+	bool ActorFacts::GetLive(Actor* actor, ActorFact fact) {
+		switch (fact) {
+			case ActorFact::GtsBusy: {
+				bool GTSBusy = false;
+				actor->GetGraphVariableBool("GTS_Busy", GTSBusy);
+				return GTSBusy && !CanDoCombo(actor);
+			}
+			case ActorFact::Teammate: {
+				//A player can't be their own teammate
+				if (actor->formID == 0x14) {
+					return false;
+				}
+				return Runtime::InFaction(actor, "FollowerFaction") || actor->IsPlayerTeammate() || IsGtsTeammate(actor);
+			}
+			case ActorFact::Essential: {
+				return actor->IsEssential();
+			}
+			case ActorFact::HostileToPlayer: {
+				auto player = PlayerCharacter::GetSingleton();
+				return player && actor->IsHostileToActor(player);
+			}
+			case ActorFact::PlayerHostileTo: {
+				auto player = PlayerCharacter::GetSingleton();
+				return player && player->IsHostileToActor(actor);
+			}
+			default: {
+				return false;
+			}
+		}
+	}
+
+	bool ActorFacts::Get(Actor* actor, ActorFact fact) {
+		if (!actor || fact == ActorFact::Count) {
+			return false;
+		}
+		if (!OnMainUpdateThread()) {
+			return GetLive(actor, fact);
+		}
+
+		auto& me = GetSingleton();
+		const std::uint64_t frame = Time::FramesElapsed();
+		auto& entry = me.entries[actor->formID];
+		if (entry.frame != frame) {
+			entry.frame = frame;
+			entry.known = 0;
+			entry.values = 0;
+		}
+
+		const std::uint8_t bit = static_cast<std::uint8_t>(1u << static_cast<std::uint8_t>(fact));
+		if (fact == ActorFact::GtsBusy) {
+			// Animation events flip GTS_Busy mid-frame, re-read it when the actor's graph saw an event since
+			const std::uint32_t epoch = GraphEpoch(actor->formID).load(std::memory_order_acquire);
+			if (entry.graphEpoch != epoch) {
+				entry.graphEpoch = epoch;
+				entry.known &= ~bit;
+				entry.values &= ~bit;
+			}
+		}
+		if (!(entry.known & bit)) {
+			if (GetLive(actor, fact)) {
+				entry.values |= bit;
+			}
+			entry.known |= bit;
+		}
+		const bool cached = (entry.values & bit) != 0;
+
+		if (me.validate) {
+			me.validatedReads += 1;
+			const bool live = GetLive(actor, fact);
+			if (live != cached) {
+				me.mismatches += 1;
+				log::warn("ActorFacts: {} on {} cached {} but live {}", magic_enum::enum_name(fact), actor->GetDisplayFullName(), cached, live);
+			}
+		}
+		return cached;
+	}
+
+	void ActorFacts::Invalidate(Actor* actor) {
+		if (!actor || !OnMainUpdateThread()) {
+			return;
+		}
+		auto& me = GetSingleton();
+		auto it = me.entries.find(actor->formID);
+		if (it != me.entries.end()) {
+			it->second.frame = InvalidFrame;
+		}
+	}
+
+	void ActorFacts::OnGraphEvent(Actor* actor) {
+		if (actor) {
+			GraphEpoch(actor->formID).fetch_add(1, std::memory_order_release);
+		}
+	}
+
+	void ActorFacts::ToggleValidation() {
+		auto& me = GetSingleton();
+		if (me.validate) {
+			Cprint("ActorFacts validation off: {} reads checked, {} mismatches", me.validatedReads, me.mismatches);
+		} else {
+			Cprint("ActorFacts validation on, mismatches are written to the log");
+		}
+		me.validate = !me.validate;
+		me.validatedReads = 0;
+		me.mismatches = 0;
+	}
+
+	void ActorFacts::Benchmark() {
+		const auto actors = Bench::LoadedActors();
+		if (actors.empty()) {
+			return;
+		}
+
+		// Same shape as the per-frame pair checks: every actor against every other actor
+		auto pass = [&actors](auto&& a_query) {
+			std::uint64_t sink = 0;
+			for (auto giant : actors) {
+				for (auto tiny : actors) {
+					if (giant == tiny) {
+						continue;
+					}
+					sink += a_query(giant, ActorFact::GtsBusy);
+					sink += a_query(tiny, ActorFact::Teammate);
+					sink += a_query(tiny, ActorFact::Essential);
+					sink += a_query(tiny, ActorFact::HostileToPlayer);
+				}
+			}
+			return sink;
+		};
+
+		auto& me = GetSingleton();
+		const bool validate = me.validate;
+		me.validate = false;
+
+		std::uint64_t liveSink = 0;
+		std::uint64_t cachedSink = 0;
+		const double live = Bench::TimeUs(1, [&]() {
+			liveSink = pass([](Actor* a_actor, ActorFact a_fact) { return GetLive(a_actor, a_fact); });
+		});
+		const double cached = Bench::TimeUs(1, [&]() {
+			cachedSink = pass([](Actor* a_actor, ActorFact a_fact) { return Get(a_actor, a_fact); });
+		});
+
+		me.validate = validate;
+
+		const std::size_t queries = actors.size() * (actors.size() - 1) * 4;
+		Cprint("--- Actor Facts Benchmark ({} actors, {} queries) ---", actors.size(), queries);
+		Cprint("Live: {:.1f} us/frame", live);
+		Cprint("Cached: {:.1f} us/frame", cached);
+		Cprint("Results match: {}", liveSink == cachedSink);
+	}
+}
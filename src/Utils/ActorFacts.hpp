@@ -0,0 +1,66 @@
+#pragma once
+
+// Per-frame cache of actor facts that are expensive to query from the engine
+//
+// Helpers such as IsTeammate, IsHostile and IsGtsBusy are called per giant/tiny pair several times a frame,
+// each call goes through faction lists, keywords, graph variables or the hostility check.
+// Each fact is computed at most once per actor per frame, the first time it is asked for.
+
+namespace GTS {
+
+	enum class ActorFact : std::uint8_t {
+		GtsBusy,         // GTS_Busy graph variable and not in a combo window
+		Teammate,        // Follower faction, player teammate or GTS follower keyword
+		Essential,       // Actor::IsEssential
+		HostileToPlayer, // actor->IsHostileToActor(player)
+		PlayerHostileTo, // player->IsHostileToActor(actor)
+		Count,
+	};
+
+	class ActorFacts : public EventListener {
+		public:
+			[[nodiscard]] static ActorFacts& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void DataReady() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+			virtual void ResetActor(Actor* actor) override;
+
+			// Off the main update thread this queries the engine directly
+			static bool Get(Actor* actor, ActorFact fact);
+			static bool GetLive(Actor* actor, ActorFact fact);
+
+			// Forget everything known about the actor this frame (e.g. after changing factions or teammate state)
+			static void Invalidate(Actor* actor);
+			// Called from the animation graph event hook on any thread, the event may have flipped GTS_Busy or the combo window
+			static void OnGraphEvent(Actor* actor);
+
+			// When enabled every cached read is also queried live and mismatches are counted
+			static void ToggleValidation();
+			static void Benchmark();
+
+		private:
+			struct Entry {
+				std::uint64_t frame = std::numeric_limits<std::uint64_t>::max();
+				// GraphEpochs value GtsBusy was read at
+				std::uint32_t graphEpoch = 0;
+				std::uint8_t known = 0;
+				std::uint8_t values = 0;
+			};
+
+			// Bumped per actor (hashed by form id) on every graph event, lock free so the hook can run on any thread
+			static constexpr std::size_t GraphEpochSlots = 256;
+			static inline std::array<std::atomic<std::uint32_t>, GraphEpochSlots> GraphEpochs = {};
+
+			static std::atomic<std::uint32_t>& GraphEpoch(FormID id) {
+				return GraphEpochs[id % GraphEpochSlots];
+			}
+
+			std::unordered_map<FormID, Entry> entries;
+
+			bool validate = false;
+			std::uint64_t validatedReads = 0;
+			std::uint64_t mismatches = 0;
+	};
+}
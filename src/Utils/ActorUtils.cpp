@@ -21,8 +21,10 @@
 #include "Managers/Attributes.hpp"
 #include "Managers/Rumble.hpp"
 #include "Managers/Explosion.hpp"
+#include "Managers/EffectScheduler.hpp"
 #include "Managers/GtsSizeManager.hpp"
 #include "Managers/HighHeel.hpp"
+#include "Scale/SizeCache.hpp"
 
 #include "Managers/Audio/AudioObtainer.hpp"
 #include "Managers/Audio/MoansLaughs.hpp"
@@ -357,23 +359,16 @@ namespace GTS {
 			actor_data->half_life = halflife;
 		}
 
-		double Start = Time::WorldTimeElapsed();
 		ActorHandle tinyhandle = tiny->CreateRefHandle();
 		std::string name = std::format("AdjustHalfLife_{}", tiny->formID);
-		TaskManager::Run(name, [=](auto& progressData) {
+		TimerManager::After(name, revert_after, [=]() {
 			if (!tinyhandle) {
-				return false;
+				return;
 			}
-			auto tinyref = tinyhandle.get().get();
-			double timepassed = Time::WorldTimeElapsed() - Start;
-			if (timepassed > revert_after) {
-				if (actor_data) {
-					actor_data->half_life = old_halflife;
-				}
-				return false;
+			// Look the entry up again, a load in between clears the data the old pointer points into
+			if (auto data = Persistent::GetSingleton().GetData(tinyhandle.get().get())) {
+				data->half_life = old_halflife;
 			}
-
-			return true;
 		});
 	}
 
@@ -382,20 +377,12 @@ namespace GTS {
 			return; //Don't reset Player
 		}
 		std::string name = std::format("ResetActor_{}", tiny->formID);
-		double Start = Time::WorldTimeElapsed();
 		ActorHandle tinyhandle = tiny->CreateRefHandle();
-		TaskManager::Run(name, [=](auto& progressData) {
+		TimerManager::After(name, 1.0, [=]() {
 			if (!tinyhandle) {
-				return false;
-			}
-			auto tiny = tinyhandle.get().get();
-			double Finish = Time::WorldTimeElapsed();
-			double timepassed = Finish - Start;
-			if (timepassed < 1.0) {
-				return true; // not enough time has passed yet
+				return;
 			}
-			EventDispatcher::DoResetActor(tiny);
-			return false; // stop task, we reset the actor
+			EventDispatcher::DoResetActor(tinyhandle.get().get());
 		});
 	}
 
@@ -579,6 +566,13 @@ namespace GTS {
 	}
 
 	bool IsHostile(Actor* giant, Actor* tiny) {
+		// Nearly every hostility check involves the player, those are cached per frame
+		if (giant->formID == 0x14) {
+			return ActorFacts::Get(tiny, ActorFact::HostileToPlayer);
+		}
+		if (tiny->formID == 0x14) {
+			return ActorFacts::Get(giant, ActorFact::PlayerHostileTo);
+		}
 		return tiny->IsHostileToActor(giant);
 	}
 
@@ -624,7 +618,7 @@ namespace GTS {
 
 		auto& Settings = Config::GetGeneral();
 
-		const bool ProtectEssential = actor->IsEssential() && Settings.bProtectEssentials;
+		const bool ProtectEssential = Settings.bProtectEssentials && ActorFacts::Get(actor, ActorFact::Essential);
 		const bool ProtectFollowers = Settings.bProtectFollowers;
 		const bool Teammate = IsTeammate(actor);
 
@@ -869,6 +863,12 @@ namespace GTS {
 	}
 
 	float GetSizeDifference(Actor* giant, Actor* tiny, SizeType Type, bool Check_SMT, bool HH) {
+		GTS_PROFILE_SCOPE("ActorUtils: GetSizeDifference");
+
+		// Both sides come from the per-frame size cache
+		const SizeComponents Giant = SizeCache::Get(giant);
+		const SizeComponents Tiny = SizeCache::Get(tiny);
+
 		float hh_gts = 0.0f; 
 		float hh_tiny = 0.0f;
 
@@ -876,32 +876,32 @@ namespace GTS {
 		float TinyScale = 1.0f;
 
 		if (HH) { // Apply HH only in cases when we need it, such as damage and hugs
-			hh_gts = HighHeelManager::GetHHOffset(giant)[2] * 0.01f;
-			hh_tiny = HighHeelManager::GetHHOffset(tiny)[2] * 0.01f;
+			hh_gts = Giant.hhOffset;
+			hh_tiny = Tiny.hhOffset;
 		}
 		
 		switch (Type) {
 			case SizeType::GiantessScale: 
-				GiantScale = get_giantess_scale(giant) + hh_gts;
-				TinyScale = get_giantess_scale(tiny) + hh_tiny;
+				GiantScale = Giant.giantess + hh_gts;
+				TinyScale = Tiny.giantess + hh_tiny;
 			break;
 			case SizeType::VisualScale: 
-				GiantScale = (get_visual_scale(giant) + hh_gts) * GetSizeFromBoundingBox(giant);
-				TinyScale = (get_visual_scale(tiny) + hh_tiny) * GetSizeFromBoundingBox(tiny);
+				GiantScale = (Giant.visual + hh_gts) * Giant.bbMult;
+				TinyScale = (Tiny.visual + hh_tiny) * Tiny.bbMult;
 			break;
 			case SizeType::TargetScale:
-				GiantScale = get_target_scale(giant) + hh_gts;
-				TinyScale = get_target_scale(tiny) + hh_tiny;
+				GiantScale = Giant.target + hh_gts;
+				TinyScale = Tiny.target + hh_tiny;
 			break;
 		}
 
 		if (Check_SMT) {
-			if (HasSMT(giant)) {
+			if (Giant.smt) {
 				GiantScale += 10.2f;
 			} 
 		}
 
-		if (tiny->formID == 0x14 && HasSMT(tiny)) {
+		if (tiny->formID == 0x14 && Tiny.smt) {
 			TinyScale += 1.50f;
 		}
 
@@ -1143,6 +1143,7 @@ namespace GTS {
 				amt /= game_getactorscale(giant);
 				Persistent->target_scale += amt;
 				Persistent->visual_scale += amt;
+				SizeCache::Invalidate(giant);
 			}
 		}
 	}
@@ -1541,16 +1542,7 @@ namespace GTS {
 			return false;
 		}
 
-		//A player can't be their own teammate
-		if (actor->formID == 0x14) {
-			return false;
-		}
-
-		if (Runtime::InFaction(actor, "FollowerFaction") || actor->IsPlayerTeammate() || IsGtsTeammate(actor)) {
-			return true;
-		}
-
-		return false;
+		return ActorFacts::Get(actor, ActorFact::Teammate);
 	}
 
 	bool EffectsForEveryone(Actor* giant) { // determines if we want to apply size effects for literally every single actor
@@ -1749,11 +1741,7 @@ namespace GTS {
 
 	bool IsGtsBusy(Actor* actor) {
 		GTS_PROFILE_SCOPE("ActorUtils: IsGtsBusy"); 
-		bool GTSBusy = false;
-		actor->GetGraphVariableBool("GTS_Busy", GTSBusy);
-
-		bool Busy = GTSBusy && !CanDoCombo(actor);
-		return Busy;
+		return ActorFacts::Get(actor, ActorFact::GtsBusy);
 	}
 
 	bool IsStomping(Actor* actor) {
@@ -2278,6 +2266,9 @@ namespace GTS {
 	}
 
 	void SpawnParticle(Actor* actor, float lifetime, const char* modelName, const NiMatrix3& rotation, const NiPoint3& position, float scale, std::uint32_t flags, NiAVObject* target) {
+		if (EffectScheduler::QueueParticle(actor, lifetime, modelName, rotation, position, scale, flags, target)) {
+			return;
+		}
 		auto cell = actor->GetParentCell();
 		if (cell) {
 			BSTempEffectParticle::Spawn(cell, lifetime, modelName, rotation, position, scale, flags, target);
@@ -2289,6 +2280,9 @@ namespace GTS {
 		if (result) {
 			BGSExplosion* base_explosion = Runtime::GetExplosion("GTSExplosionDraugr");
 			if (base_explosion) {
+				if (EffectScheduler::QueueExplosion(giant, base_explosion, result->world.translate, 3 * get_visual_scale(tiny) * size, true)) {
+					return;
+				}
 				NiPointer<TESObjectREFR> instance_ptr = giant->PlaceObjectAtMe(base_explosion, false);
 				if (!instance_ptr) {
 					return;
@@ -3263,6 +3257,7 @@ namespace GTS {
 						}
 						actorData->target_scale += deltaScale;
 						growData->addedSoFar = totalScaleToAdd;
+						SizeCache::Invalidate(actor);
 					}
 				}
 			}
@@ -3293,6 +3288,7 @@ namespace GTS {
 					actorData->target_scale += deltaScale;
 					actorData->visual_scale += deltaScale;
 					growData->addedSoFar = totalScaleToAdd;
+					SizeCache::Invalidate(actor);
 				}
 			}
 
@@ -3551,6 +3547,10 @@ namespace GTS {
 	}
 	
 	void InflictSizeDamage(Actor* attacker, Actor* receiver, float value) {
+		InflictSizeDamage(attacker, receiver, value, value);
+	}
+
+	void InflictSizeDamage(Actor* attacker, Actor* receiver, float value, float largest_hit) {
 
 		if (attacker->formID == 0x14 && IsTeammate(receiver)) {
 			if (Config::GetBalance().bFollowerFriendlyImmunity) {
@@ -3569,14 +3569,15 @@ namespace GTS {
 			float difficulty = 2.0f; // taking Legendary Difficulty as a base
 			float levelbonus = 1.0f + ((GetGtsSkillLevel(attacker) * 0.01f) * 0.50f);
 			value *= levelbonus;
+			largest_hit *= levelbonus;
 
 			if (receiver->formID != 0x14) { // Mostly a warning to indicate that actor dislikes it (They don't always aggro right away, with mods at least)
-				if (value >= GetAV(receiver, ActorValue::kHealth) * 0.50f || HpPercentage < 0.70f) { // in that case make hostile
+				if (largest_hit >= GetAV(receiver, ActorValue::kHealth) * 0.50f || HpPercentage < 0.70f) { // in that case make hostile
 					if (!IsTeammate(receiver) && !IsHostile(attacker, receiver)) {
 						StartCombat(receiver, attacker); // Make actor hostile and add bounty of 40 (can't be configured, needs different hook probably). 
 					}
 				}
-				if (value > 1.0f) { // To prevent aggro when briefly colliding
+				if (largest_hit > 1.0f) { // To prevent aggro when briefly colliding
 					Attacked(receiver, attacker);
 				}
 			} 
@@ -308,6 +308,8 @@ namespace GTS {
 	void SpawnCustomParticle(Actor* actor, ParticleType Type, NiPoint3 spawn_at_point, std::string_view spawn_at_node, float scale_mult);
 
 	void InflictSizeDamage(Actor* attacker, Actor* receiver, float value);
+	// Applies value but decides on aggro and combat from largest_hit alone, for damage summed from several hits
+	void InflictSizeDamage(Actor* attacker, Actor* receiver, float value, float largest_hit);
 
 	float Sound_GetFallOff(NiAVObject* source, float mult);
 
@@ -0,0 +1,30 @@
+#include "Utils/DeathGrouping.hpp"
+
+namespace GTS {
+
+	std::string SummarizeVictims(std::span<const std::string_view> a_names) {
+		std::vector<std::pair<std::string_view, std::uint32_t>> counts;
+		for (const auto name : a_names) {
+			auto found = std::find_if(counts.begin(), counts.end(), [name](const auto& entry) {
+				return entry.first == name;
+			});
+			if (found == counts.end()) {
+				counts.emplace_back(name, 1);
+			} else {
+				found->second += 1;
+			}
+		}
+
+		std::string victims;
+		for (const auto& [name, count] : counts) {
+			if (!victims.empty()) {
+				victims += ", ";
+			}
+			victims += name;
+			if (count > 1) {
+				victims += " x" + std::to_string(count);
+			}
+		}
+		return victims;
+	}
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+// Grouping for DeathReporter, kept free of game types
+
+namespace GTS {
+
+	// Indices of a_records grouped by a_key(record), groups and the indices in them keep first-seen order
+	template <class Record, class KeyFn>
+	std::vector<std::vector<std::size_t>> GroupInOrder(std::span<const Record> a_records, KeyFn&& a_key) {
+		using Key = std::invoke_result_t<KeyFn&, const Record&>;
+		std::vector<Key> keys;
+		std::vector<std::vector<std::size_t>> groups;
+		for (std::size_t i = 0; i < a_records.size(); ++i) {
+			const Key key = a_key(a_records[i]);
+			auto found = std::find(keys.begin(), keys.end(), key);
+			if (found == keys.end()) {
+				keys.push_back(key);
+				groups.push_back({ i });
+			} else {
+				groups[static_cast<std::size_t>(found - keys.begin())].push_back(i);
+			}
+		}
+		return groups;
+	}
+
+	// "Bandit x9, Bandit Marauder x5", names in first-seen order
+	std::string SummarizeVictims(std::span<const std::string_view> a_names);
+}
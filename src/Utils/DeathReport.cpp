@@ -1,6 +1,8 @@
 #include "Utils/DeathReport.hpp"
 #include "Managers/HighHeel.hpp"
 #include "Utils/KillDataUtils.hpp"
+#include "Utils/LockFreeQueue.hpp"
+#include "Utils/DeathGrouping.hpp"
 
 using namespace GTS;
 
@@ -31,15 +33,15 @@ namespace {
 		}
 	}
 
-	void VoreMessage_SwallowedAbsorbing(Actor* pred, Actor* prey) {
+	void VoreMessage_SwallowedAbsorbing(Actor* pred, std::string_view prey, bool preyDead) {
 		if (pred) {
 			int random = RandomInt(0, 3);
-			if (!prey->IsDead() && !Runtime::HasPerk(pred, "GTSPerkFullAssimilation") || random <= 1) {
-				Cprint("{} was Swallowed and is now being slowly absorbed by {}", prey->GetDisplayFullName(), pred->GetDisplayFullName());
+			if (!preyDead && !Runtime::HasPerk(pred, "GTSPerkFullAssimilation") || random <= 1) {
+				Cprint("{} was Swallowed and is now being slowly absorbed by {}", prey, pred->GetDisplayFullName());
 			} else if (random == 2) {
-				Cprint("{} is now absorbing {}", pred->GetDisplayFullName(), prey->GetDisplayFullName());
+				Cprint("{} is now absorbing {}", pred->GetDisplayFullName(), prey);
 			} else if (random >= 3) {
-				Cprint("{} will soon be completely absorbed by {}", prey->GetDisplayFullName(), pred->GetDisplayFullName());
+				Cprint("{} will soon be completely absorbed by {}", prey, pred->GetDisplayFullName());
 			}
 		}
 	}
@@ -433,81 +435,122 @@ namespace {
 			Cprint("{} obliterated {} with a kick", GiantName, TinyName);
 		}
 	}
-}
-
-
-namespace GTS {
 
-	std::string_view GetDeathNodeName(DamageSource cause) {
+	// Kill counter for a death, some sources only count the kill if the tiny was still alive
+	std::optional<SizeKillType> GetKillType(DamageSource cause, bool tiny_dead) {
 		switch (cause) {
-			case DamageSource::HandIdleR:
-			case DamageSource::HandCrawlRight:
-			case DamageSource::HandSwipeRight:
-			case DamageSource::HandSlamRight:
-			case DamageSource::HandDropRight:
-				return rHand;
-			break;
-			case DamageSource::HandIdleL:
-			case DamageSource::HandCrawlLeft:
-			case DamageSource::HandSwipeLeft:
-			case DamageSource::HandSlamLeft:
-			case DamageSource::HandDropLeft:
-			case DamageSource::HandCrushed: // When killing through grab attack, left hand
-				return lHand;
-			break;
-			case DamageSource::KickedRight:
+			case DamageSource::Shockwave:
+				return tiny_dead ? std::nullopt : std::optional(SizeKillType::kOtherSources);
+			case DamageSource::CrushedLeft:
 			case DamageSource::CrushedRight:
-			case DamageSource::WalkRight:
 			case DamageSource::FootIdleR:
-			case DamageSource::FootGrindedRight:
-			case DamageSource::FootGrindedRight_Impact:
-				return rFoot;
-			break;
-			case DamageSource::KickedLeft:
-			case DamageSource::CrushedLeft:
 			case DamageSource::FootIdleL:
+			case DamageSource::WalkRight:
 			case DamageSource::WalkLeft:
+				return tiny_dead ? std::nullopt : std::optional(SizeKillType::kCrushed);
+			case DamageSource::ShrinkToNothing:
+				return tiny_dead ? std::nullopt : std::optional(SizeKillType::kShrunkToNothing);
+			case DamageSource::HandCrushed:
+				return SizeKillType::kGrabCrushed;
+			case DamageSource::Vored:
+				return SizeKillType::kEaten;
+			case DamageSource::ThighCrushed:
+				return SizeKillType::kThighCrushed;
+			case DamageSource::ThighSandwiched:
+				return SizeKillType::kThighSandwiched;
+			case DamageSource::ThighSuffocated:
+				return SizeKillType::kThighSuffocated;
+			case DamageSource::Breast:
+			case DamageSource::BreastImpact:
+				return SizeKillType::kBreastCrushed;
+			case DamageSource::BreastAbsorb:
+				return SizeKillType::kBreastAbsorbed;
+			case DamageSource::Booty:
+				return SizeKillType::kButtCrushed;
+			case DamageSource::Hugs:
+				return SizeKillType::kHugCrushed;
 			case DamageSource::FootGrindedLeft:
+			case DamageSource::FootGrindedRight:
 			case DamageSource::FootGrindedLeft_Impact:
-				return lFoot;
-			break;
-			case DamageSource::KneeIdleR:
+			case DamageSource::FootGrindedRight_Impact:
+				return SizeKillType::kGrinded;
+			case DamageSource::RightFinger:
+			case DamageSource::LeftFinger:
+			case DamageSource::RightFinger_Impact:
+			case DamageSource::LeftFinger_Impact:
+				return SizeKillType::kFingerCrushed;
+			case DamageSource::HandSwipeLeft:
+			case DamageSource::HandSwipeRight:
+			case DamageSource::KickedLeft:
+			case DamageSource::KickedRight:
+				return SizeKillType::kKicked;
+			case DamageSource::EraseFromExistence:
+				return SizeKillType::kErasedFromExistence;
+			case DamageSource::BodyCrush:
+			case DamageSource::KneeLeft:
 			case DamageSource::KneeRight:
-			case DamageSource::KneeDropRight:
-				return rCalf;
-			break;
 			case DamageSource::KneeIdleL:
-			case DamageSource::KneeLeft:
+			case DamageSource::KneeIdleR:
 			case DamageSource::KneeDropLeft:
-				return lCalf;
-			break;
-			case DamageSource::BodyCrush:
-			case DamageSource::Hugs:
-			case DamageSource::Breast:
-			case DamageSource::BreastImpact:
-				return breast;
-			break;
-			case DamageSource::Booty:
-				return booty;
-			break;	
-			case DamageSource::ThighSandwiched:
-			case DamageSource::ThighCrushed:
-				return rThigh;
-			break;
+			case DamageSource::KneeDropRight:
+			case DamageSource::HandCrawlLeft:
+			case DamageSource::HandCrawlRight:
+			case DamageSource::HandDropRight:
+			case DamageSource::HandDropLeft:
+			case DamageSource::HandIdleL:
+			case DamageSource::HandIdleR:
+			case DamageSource::HandSlamLeft:
+			case DamageSource::HandSlamRight:
+				return SizeKillType::kCrushed;
+			case DamageSource::Collision:
+			case DamageSource::Overkill:
+			case DamageSource::HitSteal:
+			case DamageSource::Explode:
+			case DamageSource::BlockDamage:
+			case DamageSource::Melted:
+				return SizeKillType::kOtherSources;
 			default:
-				return none;
-			break;
+				return std::nullopt;
 		}
 	}
 
-	void ReportDeath(Actor* giant, Actor* tiny, DamageSource cause, bool vore_absorbed) {
+	// Used for the summary line when a burst of kills gets coalesced
+	std::string_view GetSummaryVerb(DamageSource cause) {
+		switch (cause) {
+			case DamageSource::Vored:
+			case DamageSource::BreastAbsorb:
+				return "devoured";
+			case DamageSource::ShrinkToNothing:
+				return "shrunk to nothing";
+			case DamageSource::FootGrindedLeft:
+			case DamageSource::FootGrindedRight:
+			case DamageSource::FootGrindedLeft_Impact:
+			case DamageSource::FootGrindedRight_Impact:
+				return "ground to dust";
+			case DamageSource::HandSwipeLeft:
+			case DamageSource::HandSwipeRight:
+			case DamageSource::KickedLeft:
+			case DamageSource::KickedRight:
+				return "sent flying";
+			case DamageSource::Shockwave:
+			case DamageSource::Collision:
+			case DamageSource::Overkill:
+			case DamageSource::Explode:
+			case DamageSource::Melted:
+				return "obliterated";
+			case DamageSource::EraseFromExistence:
+				return "erased";
+			default:
+				return "crushed";
+		}
+	}
+
+	void PrintDeathMessage(Actor* giant, std::string_view TinyName, DamageSource cause, bool tiny_dead, bool vore_absorbed) {
 		int random = RandomInt(0, 8);
 
-		std::string_view TinyName = tiny->GetDisplayFullName();
 		std::string_view GiantName = giant->GetDisplayFullName();
 		switch (cause) {
 			case DamageSource::Shockwave:
-			if (!tiny->IsDead()) {IncrementKillCount(giant, SizeKillType::kOtherSources); }
 				ShockwaveMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::CrushedLeft:
@@ -516,86 +559,66 @@ namespace GTS {
 			case DamageSource::FootIdleL:
 			case DamageSource::WalkRight:
 			case DamageSource::WalkLeft:
-			if (!tiny->IsDead()) {IncrementKillCount(giant, SizeKillType::kCrushed); }
 				CrushedMessage(GiantName, TinyName, random, HighHeelManager::IsWearingHH(giant));
 			break;
 			case DamageSource::HandCrushed:
-				IncrementKillCount(giant, SizeKillType::kGrabCrushed);
 				HandGrabCrushedMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::Collision:
-				IncrementKillCount(giant, SizeKillType::kOtherSources);
 				CollisionMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::ShrinkToNothing:
-			if (!tiny->IsDead()) {IncrementKillCount(giant, SizeKillType::kShrunkToNothing);}
 				ShrinkToNothingMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::Vored:
-				vore_absorbed ? VoreMessage_Absorbed(giant, TinyName) : VoreMessage_SwallowedAbsorbing(giant, tiny);
-				IncrementKillCount(giant, SizeKillType::kEaten);
+				vore_absorbed ? VoreMessage_Absorbed(giant, TinyName) : VoreMessage_SwallowedAbsorbing(giant, TinyName, tiny_dead);
 			break;
 			case DamageSource::ThighCrushed:
-				IncrementKillCount(giant, SizeKillType::kThighCrushed);
 				ThighCrushedMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::ThighSandwiched:
-				IncrementKillCount(giant, SizeKillType::kThighSandwiched);
 				ThighSandwichedMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::ThighSuffocated:
-				IncrementKillCount(giant, SizeKillType::kThighSuffocated);
 				ThighSuffocatedMessage(GiantName, TinyName);
 			break;
 			case DamageSource::BodyCrush:
-				IncrementKillCount(giant, SizeKillType::kCrushed);
 				BodyCrushedMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::Overkill:
-				IncrementKillCount(giant, SizeKillType::kOtherSources);
 				OverkillMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::HitSteal:
-				IncrementKillCount(giant, SizeKillType::kOtherSources);
 				HitStealMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::Explode:
-				IncrementKillCount(giant, SizeKillType::kOtherSources);
 				PoisonOfShrinkMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::BlockDamage:	
-				IncrementKillCount(giant, SizeKillType::kOtherSources);
 				DamageShareMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::FootGrindedLeft:
 			case DamageSource::FootGrindedRight:
 			case DamageSource::FootGrindedLeft_Impact:
 			case DamageSource::FootGrindedRight_Impact:
-				IncrementKillCount(giant, SizeKillType::kGrinded);
 				FootGrindedMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::Melted: 
-				IncrementKillCount(giant, SizeKillType::kOtherSources);
 				MeltedMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::Breast:
-				IncrementKillCount(giant, SizeKillType::kBreastCrushed);
 				BreastGrabMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::BreastImpact: 
-				IncrementKillCount(giant, SizeKillType::kBreastCrushed);
 				BreastCrushMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::BreastAbsorb:
-				IncrementKillCount(giant, SizeKillType::kBreastAbsorbed);
 				BreastAbsorbedMessage(GiantName, TinyName);
 			break;
 			case DamageSource::Booty:
-				IncrementKillCount(giant, SizeKillType::kButtCrushed);
 				ButtCrushMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::Hugs: 
-				IncrementKillCount(giant, SizeKillType::kHugCrushed);
 				HugCrushMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::KneeLeft:
@@ -604,7 +627,6 @@ namespace GTS {
 			case DamageSource::KneeIdleR:
 			case DamageSource::KneeDropLeft:
 			case DamageSource::KneeDropRight:
-				IncrementKillCount(giant, SizeKillType::kCrushed);
 				KneeCrushMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::HandCrawlLeft:
@@ -613,35 +635,216 @@ namespace GTS {
 			case DamageSource::HandDropLeft:
 			case DamageSource::HandIdleL:
 			case DamageSource::HandIdleR:
-				IncrementKillCount(giant, SizeKillType::kCrushed);
 				HandCrushedMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::HandSlamLeft:
 			case DamageSource::HandSlamRight:
-				IncrementKillCount(giant, SizeKillType::kCrushed);
 				HandSlammedMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::RightFinger:
 			case DamageSource::LeftFinger:
 			case DamageSource::RightFinger_Impact:
 			case DamageSource::LeftFinger_Impact:
-				IncrementKillCount(giant, SizeKillType::kFingerCrushed);
 				FingerGrindedMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::HandSwipeLeft:
 			case DamageSource::HandSwipeRight:
-				IncrementKillCount(giant, SizeKillType::kKicked);
 				HandSwipeMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::KickedLeft:
 			case DamageSource::KickedRight:
-				IncrementKillCount(giant, SizeKillType::kKicked);
 				KickedMessage(GiantName, TinyName, random);
 			break;
 			case DamageSource::EraseFromExistence:
 				Cprint("{} erased {} from the world", GiantName, TinyName);
-				IncrementKillCount(giant, SizeKillType::kErasedFromExistence);
 			break;
 		}		
 	}
+
+
+	// Bursts of this many kills by the same giant and cause become one summary line
+	constexpr std::size_t CoalesceCount = 4;
+	// Once a burst has that many kills, they are held this long (world time) so the rest of it lands in the same batch
+	constexpr double CoalesceWindow = 0.25;
+
+	LockFreeQueue<DeathRecord, 1024> DeathQueue;
+
+}
+
+
+namespace GTS {
+
+	std::string_view GetDeathNodeName(DamageSource cause) {
+		switch (cause) {
+			case DamageSource::HandIdleR:
+			case DamageSource::HandCrawlRight:
+			case DamageSource::HandSwipeRight:
+			case DamageSource::HandSlamRight:
+			case DamageSource::HandDropRight:
+				return rHand;
+			break;
+			case DamageSource::HandIdleL:
+			case DamageSource::HandCrawlLeft:
+			case DamageSource::HandSwipeLeft:
+			case DamageSource::HandSlamLeft:
+			case DamageSource::HandDropLeft:
+			case DamageSource::HandCrushed: // When killing through grab attack, left hand
+				return lHand;
+			break;
+			case DamageSource::KickedRight:
+			case DamageSource::CrushedRight:
+			case DamageSource::WalkRight:
+			case DamageSource::FootIdleR:
+			case DamageSource::FootGrindedRight:
+			case DamageSource::FootGrindedRight_Impact:
+				return rFoot;
+			break;
+			case DamageSource::KickedLeft:
+			case DamageSource::CrushedLeft:
+			case DamageSource::FootIdleL:
+			case DamageSource::WalkLeft:
+			case DamageSource::FootGrindedLeft:
+			case DamageSource::FootGrindedLeft_Impact:
+				return lFoot;
+			break;
+			case DamageSource::KneeIdleR:
+			case DamageSource::KneeRight:
+			case DamageSource::KneeDropRight:
+				return rCalf;
+			break;
+			case DamageSource::KneeIdleL:
+			case DamageSource::KneeLeft:
+			case DamageSource::KneeDropLeft:
+				return lCalf;
+			break;
+			case DamageSource::BodyCrush:
+			case DamageSource::Hugs:
+			case DamageSource::Breast:
+			case DamageSource::BreastImpact:
+				return breast;
+			break;
+			case DamageSource::Booty:
+				return booty;
+			break;	
+			case DamageSource::ThighSandwiched:
+			case DamageSource::ThighCrushed:
+				return rThigh;
+			break;
+			default:
+				return none;
+			break;
+		}
+	}
+
+	void ReportDeath(Actor* giant, Actor* tiny, DamageSource cause, bool vore_absorbed) {
+		if (!giant || !tiny) {
+			return;
+		}
+		DeathRecord record = {
+			.giant = giant->formID,
+			.cause = cause,
+			.tinyDead = tiny->IsDead(),
+			.voreAbsorbed = vore_absorbed,
+			.time = Time::WorldTimeElapsed(),
+		};
+		const std::string_view name = tiny->GetDisplayFullName();
+		const std::size_t length = std::min(name.size(), record.tinyName.size() - 1);
+		std::memcpy(record.tinyName.data(), name.data(), length);
+
+		if (!DeathQueue.TryPush(record)) {
+			// Queue is full, report right away like before
+			PrintDeathMessage(giant, name, cause, record.tinyDead, vore_absorbed);
+			if (auto type = GetKillType(cause, record.tinyDead)) {
+				IncrementKillCount(giant, *type);
+			}
+		}
+	}
+
+	DeathReporter& DeathReporter::GetSingleton() noexcept {
+		static DeathReporter instance;
+		return instance;
+	}
+
+	std::string DeathReporter::DebugName() {
+		return "::DeathReporter";
+	}
+
+	void DeathReporter::Update() {
+		DeathRecord record;
+		while (DeathQueue.TryPop(record)) {
+			this->pending.push_back(record);
+		}
+		if (this->pending.empty()) {
+			return;
+		}
+		// Too few to summarize, report them now so a load right after doesn't lose them
+		if (this->pending.size() < CoalesceCount || Time::WorldTimeElapsed() - this->pending.front().time >= CoalesceWindow) {
+			this->Flush();
+		}
+	}
+
+	void DeathReporter::Reset() {
+		DeathRecord record;
+		while (DeathQueue.TryPop(record)) {}
+		this->pending.clear();
+	}
+
+	void DeathReporter::Flush() {
+		GTS_PROFILE_SCOPE("DeathReporter: Flush");
+
+		// Group by giant and cause, keeping first-seen order
+		const auto groups = GroupInOrder(std::span<const DeathRecord>(this->pending), [](const DeathRecord& record) {
+			return std::make_pair(record.giant, record.cause);
+		});
+
+		// Kill counts are applied once per giant and kill type
+		std::map<std::pair<FormID, SizeKillType>, std::uint32_t> kills;
+
+		for (const auto& group : groups) {
+			const FormID giantId = this->pending[group.front()].giant;
+			const DamageSource cause = this->pending[group.front()].cause;
+
+			// Counted before the lookup, a giant we can't name still gets its kills
+			for (auto index : group) {
+				const auto& record = this->pending[index];
+				if (auto type = GetKillType(record.cause, record.tinyDead)) {
+					kills[{ giantId, *type }] += 1;
+				}
+			}
+
+			Actor* giant = TESForm::LookupByID<Actor>(giantId);
+			if (!giant) {
+				log::warn("DeathReporter: giant {:08X} is gone, {} death messages skipped", giantId, group.size());
+				continue;
+			}
+
+			if (group.size() < CoalesceCount) {
+				for (auto index : group) {
+					const auto& record = this->pending[index];
+					PrintDeathMessage(giant, record.tinyName.data(), record.cause, record.tinyDead, record.voreAbsorbed);
+				}
+				continue;
+			}
+
+			// "Giant crushed 14 (Bandit x9, Bandit Marauder x5)"
+			std::vector<std::string_view> names;
+			names.reserve(group.size());
+			for (auto index : group) {
+				names.emplace_back(this->pending[index].tinyName.data());
+			}
+			Cprint("{} {} {} ({})", giant->GetDisplayFullName(), GetSummaryVerb(cause), group.size(), SummarizeVictims(names));
+		}
+
+		for (const auto& [key, amount] : kills) {
+			Actor* giant = TESForm::LookupByID<Actor>(key.first);
+			if (giant) {
+				IncrementKillCount(giant, key.second, amount);
+			}
+			else {
+				log::warn("DeathReporter: giant {:08X} is gone, {} kills not counted", key.first, amount);
+			}
+		}
+
+		this->pending.clear();
+	}
 }
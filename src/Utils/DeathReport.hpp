@@ -1,6 +1,38 @@
 #pragma once
 
+// Death messages and kill counts
+//
+// ReportDeath only queues a small record, the messages are formatted and kill counts applied
+// by DeathReporter a moment later so mass kills don't stall the frame they happen in.
+// Bursts by the same giant and cause are printed as a single summary line.
+
 namespace GTS {
+
+	// Pushed from the kill paths, everything else is resolved when the queue is drained
+	struct DeathRecord {
+		FormID giant = 0;
+		DamageSource cause = DamageSource::Collision;
+		bool tinyDead = false;
+		bool voreAbsorbed = false;
+		double time = 0.0;
+		std::array<char, 64> tinyName = {}; // Copied, the tiny may be gone by the time we print
+	};
+
+	class DeathReporter : public EventListener {
+		public:
+			[[nodiscard]] static DeathReporter& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+
+		private:
+			void Flush();
+
+			std::vector<DeathRecord> pending;
+	};
+
 	std::string_view GetDeathNodeName(DamageSource cause);
+	// Safe to call from any thread
 	void ReportDeath(Actor* giant, Actor* tiny, DamageSource cause, bool vore_absorbed = false);
-}
\ No newline at end of file
+}
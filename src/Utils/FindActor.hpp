@@ -25,8 +25,14 @@ namespace GTS {
 
 	vector<Actor*> FindFemaleTeammates();
 
-	static inline std::atomic<std::thread::id> main_update_thread_id{};
-	static inline std::vector<Actor*> cached_actors;
-	static inline std::mutex cache_mutex;
-	static inline std::atomic<bool> cache_valid{ false };
+	// Not static, every translation unit (and unity batch) has to share the one set by the main update hook
+	inline std::atomic<std::thread::id> main_update_thread_id{};
+	inline std::vector<Actor*> cached_actors;
+	inline std::mutex cache_mutex;
+	inline std::atomic<bool> cache_valid{ false };
+
+	// True on the thread that runs the main update, per-frame caches are only filled there
+	[[nodiscard]] inline bool OnMainUpdateThread() {
+		return std::this_thread::get_id() == main_update_thread_id.load();
+	}
 }
\ No newline at end of file
@@ -0,0 +1,200 @@
+#include "Utils/InventoryTransfer.hpp"
+#include "Managers/Console/ConsoleManager.hpp"
+#include "Profiler/Bench.hpp"
+
+namespace {
+
+	using Clock = std::chrono::steady_clock;
+
+	// Time item moves may take per frame, across every transfer running that frame. Checked before a transfer starts,
+	// the one that crosses it still finishes
+	constexpr double FrameBudgetMs = 1.0;
+
+	double ElapsedMs(Clock::time_point a_start) {
+		return std::chrono::duration<double, std::milli>(Clock::now() - a_start).count();
+	}
+}
+
+namespace GTS {
+
+	InventoryTransfer& InventoryTransfer::GetSingleton() noexcept {
+		static InventoryTransfer instance;
+		return instance;
+	}
+
+	std::string InventoryTransfer::DebugName() {
+		return "::InventoryTransfer";
+	}
+
+	void InventoryTransfer::DataReady() {
+		Bench::Register("loot", Benchmark, "Plan a transfer of the player inventory without moving it, check it and time it against the old scan");
+	}
+
+	void InventoryTransfer::Update() {
+		if (this->jobs.empty()) {
+			return;
+		}
+		GTS_PROFILE_SCOPE("InventoryTransfer: Update");
+		while (!this->jobs.empty()) {
+			if (!this->Step(this->jobs.front())) {
+				return;
+			}
+			this->jobs.pop_front();
+		}
+	}
+
+	void InventoryTransfer::Reset() {
+		// Handles from before a load point at nothing
+		this->jobs.clear();
+	}
+
+	bool InventoryTransfer::IsMovable(TESBoundObject* object) {
+		auto compute = [object]() {
+			return object->GetPlayable() && object->GetFormType() != FormType::LeveledItem; // We don't want to move Leveled Items
+		};
+		if (object->IsDynamicForm()) {
+			// Runtime form ids get reused
+			return compute();
+		}
+		auto [found, inserted] = this->movable.try_emplace(object->formID, false);
+		if (inserted) {
+			found->second = compute();
+		}
+		return found->second;
+	}
+
+	std::vector<InventoryTransfer::Item> InventoryTransfer::Plan(TESObjectREFR* from, bool includeQuest) {
+		std::vector<Item> items;
+		if (!from) {
+			return items;
+		}
+
+		auto& me = GetSingleton();
+		std::unordered_map<TESBoundObject*, std::size_t> index;
+		auto add = [&](TESBoundObject* object, std::int32_t count, bool quest) {
+			// GetInventory skipped deleted and ignored forms, so do we
+			if (!object || object->IsDeleted() || object->IsIgnored() || !me.IsMovable(object)) {
+				return;
+			}
+			auto [found, inserted] = index.try_emplace(object, items.size());
+			if (inserted) {
+				items.push_back(Item { .object = object, .count = count, .quest = quest });
+			}
+			else {
+				items[found->second].count += count;
+				items[found->second].quest |= quest;
+			}
+		};
+
+		// Base container counts plus the deltas in the changes, the same sum GetInventory does
+		if (auto container = from->GetContainer()) {
+			container->ForEachContainerObject([&](ContainerObject& entry) {
+				add(entry.obj, entry.count, false);
+				return BSContainer::ForEachResult::kContinue;
+			});
+		}
+		auto changes = from->GetInventoryChanges();
+		if (changes && changes->entryList) {
+			for (auto entry : *changes->entryList) {
+				if (entry) {
+					add(entry->object, entry->countDelta, entry->IsQuestObject());
+				}
+			}
+		}
+
+		std::erase_if(items, [includeQuest](const Item& item) {
+			return item.count <= 0 || (item.quest && !includeQuest);
+		});
+		return items;
+	}
+
+	void InventoryTransfer::Queue(TESObjectREFR* from, TESObjectREFR* to, bool includeQuest) {
+		if (!from || !to) {
+			return;
+		}
+		auto& me = GetSingleton();
+		Job job { .from = from->CreateRefHandle(), .to = to->CreateRefHandle(), .items = Plan(from, includeQuest), .includeQuest = includeQuest };
+		if (job.items.empty()) {
+			return;
+		}
+		// Transfers already waiting go first so loot arrives in the order tinies died
+		if (me.jobs.empty() && me.Step(job)) {
+			return;
+		}
+		me.spilled += 1;
+		job.spilled = true;
+		me.jobs.push_back(std::move(job));
+	}
+
+	bool InventoryTransfer::Step(Job& job) {
+		const std::uint64_t frame = Time::FramesElapsed();
+		if (frame != this->budgetFrame) {
+			this->budgetFrame = frame;
+			this->spentMs = 0.0;
+		}
+
+		if (this->spentMs >= FrameBudgetMs) {
+			return false;
+		}
+
+		auto from = job.from.get();
+		auto to = job.to.get();
+		if (!from || !to) {
+			log::warn("InventoryTransfer: {} items were not moved, the {} reference is gone", job.items.size(), from ? "target" : "source");
+			return true;
+		}
+
+		const auto start = Clock::now();
+		if (job.spilled) {
+			job.items = Plan(from.get(), job.includeQuest);
+		}
+		for (const Item& item : job.items) {
+			from->RemoveItem(item.object, item.count, ITEM_REMOVE_REASON::kRemove, nullptr, to.get(), nullptr, nullptr);
+		}
+		this->spentMs += ElapsedMs(start);
+		return true;
+	}
+
+	void InventoryTransfer::Benchmark() {
+		constexpr std::size_t Rounds = 100;
+
+		auto player = PlayerCharacter::GetSingleton();
+		if (!player) {
+			return;
+		}
+
+		// What the old loops did, minus the moves
+		std::map<TESBoundObject*, std::int32_t> legacy;
+		const double legacyUs = Bench::TimeUs(Rounds, [&]() {
+			legacy.clear();
+			for (auto& [object, data] : player->GetInventory()) {
+				if (object->GetPlayable() && object->GetFormType() != FormType::LeveledItem && !data.second->IsQuestObject()) {
+					auto changes = player->GetInventoryChanges();
+					legacy[object] = changes ? GetItemCount(changes, object) : data.first;
+				}
+			}
+		});
+
+		std::vector<Item> planned;
+		const double planUs = Bench::TimeUs(Rounds, [&]() {
+			planned = Plan(player, false);
+		});
+
+		// GetItemCount is 16 bit, so only compare counts it can hold
+		std::size_t mismatches = 0;
+		for (const auto& item : planned) {
+			auto found = legacy.find(item.object);
+			if (found == legacy.end() || (item.count <= std::numeric_limits<std::int16_t>::max() && found->second != item.count)) {
+				mismatches += 1;
+				log::warn("InventoryTransfer: {} planned {} but the old scan found {}", item.object->GetName(), item.count, found == legacy.end() ? 0 : found->second);
+			}
+		}
+		mismatches += legacy.size() > planned.size() ? legacy.size() - planned.size() : 0;
+
+		auto& me = GetSingleton();
+		Cprint("--- Inventory Transfer ({} items x {}) ---", planned.size(), Rounds);
+		Cprint("Old scan: {:.0f} us, Plan: {:.0f} us", legacyUs, planUs);
+		Cprint("{} items differ from the old scan", mismatches);
+		Cprint("{} transfers waiting, {} deferred to a later frame, {} forms classified", me.jobs.size(), me.spilled, me.movable.size());
+	}
+}
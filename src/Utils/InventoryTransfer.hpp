@@ -0,0 +1,59 @@
+#pragma once
+
+// Batched inventory moves for loot piles, vore and Normal looting
+//
+// Looting used to build the full GetInventory map, rescan the inventory changes for every entry to get its count
+// and move it, which is quadratic in the size of the inventory and runs for every tiny of a crush spree.
+// A transfer now snapshots the container and its changes once, sums the counts in that same sweep and keeps
+// one entry per form that passes a cached per-form filter. Transfers start under a per-frame time budget,
+// ones that don't get to start wait for the next frames. A started transfer always finishes on the same frame,
+// crushing and shrinking disintegrate or reset the tiny right after looting and a half moved inventory would be lost.
+
+namespace GTS {
+
+	class InventoryTransfer : public EventListener {
+		public:
+			struct Item {
+				TESBoundObject* object = nullptr;
+				std::int32_t count = 0;
+				bool quest = false;
+			};
+
+			[[nodiscard]] static InventoryTransfer& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void DataReady() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+
+			// Every playable, non leveled, non deleted item of from with its total count, quest items only when includeQuest is set
+			static std::vector<Item> Plan(TESObjectREFR* from, bool includeQuest);
+
+			// Moves the planned items, right away unless the budget is spent, then as soon as a frame has room
+			static void Queue(TESObjectREFR* from, TESObjectREFR* to, bool includeQuest);
+
+			static void Benchmark();
+
+		private:
+			struct Job {
+				ObjectRefHandle from;
+				ObjectRefHandle to;
+				std::vector<Item> items;
+				bool includeQuest = false;
+				// Waited for a later frame, planned again when it starts
+				bool spilled = false;
+			};
+
+			// True when the object may be moved at all, cached for forms from plugins
+			bool IsMovable(TESBoundObject* object);
+			// Moves everything once it starts. False when the frame budget was spent before it could start
+			bool Step(Job& job);
+
+			std::deque<Job> jobs;
+			std::unordered_map<FormID, bool> movable;
+			// Time spent moving items in budgetFrame, shared by every transfer of that frame
+			std::uint64_t budgetFrame = 0;
+			double spentMs = 0.0;
+			std::size_t spilled = 0;
+	};
+}
@@ -2,7 +2,7 @@
 
 namespace GTS {
 
-    void IncrementKillCount(Actor* giant, SizeKillType Type) {
+    void IncrementKillCount(Actor* giant, SizeKillType Type, std::uint32_t Amount) {
 
 		if (!giant) {
 			return;
@@ -14,27 +14,27 @@ namespace GTS {
 
 			if (KillData) {
 
-				KillData->iTotalKills += 1; // Always increment total kills
+				KillData->iTotalKills += Amount; // Always increment total kills
 				switch (Type) {
-					case SizeKillType::kShrunkToNothing: 	KillData->iShrunkToNothing += 1;		break;
-					case SizeKillType::kOtherSources:		KillData->iOtherSources += 1;			break;
-					case SizeKillType::kBreastAbsorbed:		KillData->iBreastAbsorbed += 1;			break;
-					case SizeKillType::kBreastCrushed:		KillData->iBreastCrushed += 1;			break;
-					case SizeKillType::kBreastSuffocated:   KillData->iBreastSuffocated +=1;    	break;
-					case SizeKillType::kHugCrushed:			KillData->iHugCrushed += 1;				break;
-					case SizeKillType::kGrabCrushed:		KillData->iGrabCrushed += 1;			break;
-					case SizeKillType::kButtCrushed:		KillData->iButtCrushed += 1;			break;
-					case SizeKillType::kThighCrushed:		KillData->iThighCrushed += 1;			break;
-					case SizeKillType::kThighSuffocated:	KillData->iThighSuffocated += 1;		break;
-					case SizeKillType::kThighSandwiched:	KillData->iThighSandwiched += 1;		break;
-					case SizeKillType::kThighGrinded:		KillData->iThighGrinded += 1;			break;
-					case SizeKillType::kFingerCrushed:		KillData->iFingerCrushed += 1;			break;
-					case SizeKillType::kErasedFromExistence:KillData->iErasedFromExistence += 1;	break;
-					case SizeKillType::kAbsorbed:			KillData->iAbsorbed += 1;				break;
-					case SizeKillType::kCrushed:			KillData->iCrushed += 1;				break;
-					case SizeKillType::kEaten:				KillData->iEaten += 1;					break;
-					case SizeKillType::kKicked:				KillData->iKicked += 1;					break;
-					case SizeKillType::kGrinded:			KillData->iGrinded += 1;				break;
+					case SizeKillType::kShrunkToNothing: 	KillData->iShrunkToNothing += Amount;		break;
+					case SizeKillType::kOtherSources:		KillData->iOtherSources += Amount;			break;
+					case SizeKillType::kBreastAbsorbed:		KillData->iBreastAbsorbed += Amount;			break;
+					case SizeKillType::kBreastCrushed:		KillData->iBreastCrushed += Amount;			break;
+					case SizeKillType::kBreastSuffocated:   KillData->iBreastSuffocated += Amount;    	break;
+					case SizeKillType::kHugCrushed:			KillData->iHugCrushed += Amount;				break;
+					case SizeKillType::kGrabCrushed:		KillData->iGrabCrushed += Amount;			break;
+					case SizeKillType::kButtCrushed:		KillData->iButtCrushed += Amount;			break;
+					case SizeKillType::kThighCrushed:		KillData->iThighCrushed += Amount;			break;
+					case SizeKillType::kThighSuffocated:	KillData->iThighSuffocated += Amount;		break;
+					case SizeKillType::kThighSandwiched:	KillData->iThighSandwiched += Amount;		break;
+					case SizeKillType::kThighGrinded:		KillData->iThighGrinded += Amount;			break;
+					case SizeKillType::kFingerCrushed:		KillData->iFingerCrushed += Amount;			break;
+					case SizeKillType::kErasedFromExistence:KillData->iErasedFromExistence += Amount;	break;
+					case SizeKillType::kAbsorbed:			KillData->iAbsorbed += Amount;				break;
+					case SizeKillType::kCrushed:			KillData->iCrushed += Amount;				break;
+					case SizeKillType::kEaten:				KillData->iEaten += Amount;					break;
+					case SizeKillType::kKicked:				KillData->iKicked += Amount;					break;
+					case SizeKillType::kGrinded:			KillData->iGrinded += Amount;				break;
 				}
 			}
 		}
@@ -33,6 +33,6 @@ namespace GTS {
 		kGrinded = 19,
 	};
 
-    void IncrementKillCount(Actor* giant, SizeKillType Type);
+    void IncrementKillCount(Actor* giant, SizeKillType Type, std::uint32_t Amount = 1);
     uint32_t GetKillCount(Actor* giant, SizeKillType Type);
 }
\ No newline at end of file
@@ -0,0 +1,80 @@
+#pragma once
+
+// Bounded lock-free queue (Vyukov), safe for any number of producers and consumers
+//
+// Push never blocks or allocates, it returns false when the queue is full so the caller can fall back.
+
+namespace GTS {
+
+	template <class T, std::size_t Capacity>
+	class LockFreeQueue {
+		static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+		static_assert(std::is_trivially_copyable_v<T>, "Queue entries are copied between threads");
+
+		public:
+			LockFreeQueue() {
+				for (std::size_t i = 0; i < Capacity; ++i) {
+					this->cells[i].sequence.store(i, std::memory_order_relaxed);
+				}
+			}
+
+			LockFreeQueue(const LockFreeQueue&) = delete;
+			LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+			bool TryPush(const T& a_value) {
+				std::size_t pos = this->enqueuePos.load(std::memory_order_relaxed);
+				Cell* cell = nullptr;
+				while (true) {
+					cell = &this->cells[pos & Mask];
+					const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+					const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+					if (diff == 0) {
+						if (this->enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+							break;
+						}
+					} else if (diff < 0) {
+						return false; // Full
+					} else {
+						pos = this->enqueuePos.load(std::memory_order_relaxed);
+					}
+				}
+				cell->data = a_value;
+				cell->sequence.store(pos + 1, std::memory_order_release);
+				return true;
+			}
+
+			bool TryPop(T& a_value) {
+				std::size_t pos = this->dequeuePos.load(std::memory_order_relaxed);
+				Cell* cell = nullptr;
+				while (true) {
+					cell = &this->cells[pos & Mask];
+					const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+					const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+					if (diff == 0) {
+						if (this->dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+							break;
+						}
+					} else if (diff < 0) {
+						return false; // Empty
+					} else {
+						pos = this->dequeuePos.load(std::memory_order_relaxed);
+					}
+				}
+				a_value = cell->data;
+				cell->sequence.store(pos + Capacity, std::memory_order_release);
+				return true;
+			}
+
+		private:
+			static constexpr std::size_t Mask = Capacity - 1;
+
+			struct Cell {
+				std::atomic<std::size_t> sequence = 0;
+				T data = {};
+			};
+
+			std::array<Cell, Capacity> cells;
+			alignas(64) std::atomic<std::size_t> enqueuePos = 0;
+			alignas(64) std::atomic<std::size_t> dequeuePos = 0;
+	};
+}
@@ -1,6 +1,7 @@
 #include "Logger.hpp"
 #include "Config/Config.hpp"
 #include "Utils/Text.hpp"
+#include "Utils/LockFreeQueue.hpp"
 
 namespace {
 
@@ -46,6 +47,232 @@ namespace {
 		return path;
 	}
 
+	using SKSE::log::detail::LogRecord;
+
+	constexpr std::size_t QueueSize = 2048;
+	constexpr std::size_t SiteCount = 1024;
+	// Lines per deferred call site per second below warn level
+	constexpr std::uint32_t MaxLinesPerSite = 20;
+
+	struct Counters {
+		std::atomic<std::uint64_t> written = 0;
+		std::atomic<std::uint64_t> dropped = 0;
+		std::atomic<std::uint64_t> rateLimited = 0;
+		std::atomic<std::uint64_t> deduplicated = 0;
+	};
+
+	// Call sites share a slot when they hash together, they then just share the budget
+	struct Site {
+		std::atomic<std::int64_t> second = 0;
+		std::atomic<std::uint32_t> lines = 0;
+		std::atomic<std::uint64_t> lastHash = 0;
+		std::atomic<std::uint32_t> suppressed = 0;
+		// Where the last suppressed line came from, for the note when the site goes quiet
+		std::atomic<const char*> file = nullptr;
+		std::atomic<int> line = 0;
+		std::atomic<const char*> function = nullptr;
+		std::atomic<spdlog::level::level_enum> level = spdlog::level::info;
+	};
+
+	Counters counters;
+	std::array<Site, SiteCount> sites;
+	GTS::LockFreeQueue<LogRecord, QueueSize> queue;
+	std::shared_ptr<spdlog::sinks::sink> target;
+
+	// Only the log thread writes queued records once it runs, flushes from other threads ask it and wait
+	std::atomic<bool> workerRunning = false;
+	std::mutex flushLock;
+	std::condition_variable flushWake;
+	std::condition_variable flushDone;
+	std::uint64_t flushRequested = 0;
+	std::uint64_t flushCompleted = 0;
+
+	std::uint64_t HashBytes(const void* a_data, std::size_t a_size, std::uint64_t a_hash = 14695981039346656037ull) {
+		const auto* bytes = static_cast<const unsigned char*>(a_data);
+		for (std::size_t i = 0; i < a_size; i++) {
+			a_hash = (a_hash ^ bytes[i]) * 1099511628211ull;
+		}
+		return a_hash;
+	}
+
+	void Write(const LogRecord& a_record) {
+		fmt::memory_buffer text;
+		std::string_view payload;
+		if (a_record.format) {
+			try {
+				a_record.format(a_record, text);
+			}
+			catch (const std::exception& e) {
+				text.clear();
+				fmt::format_to(std::back_inserter(text), "Could not format log line: {}", e.what());
+			}
+			payload = std::string_view(text.data(), text.size());
+		}
+		else {
+			payload = std::string_view(a_record.payload.data(), a_record.size);
+		}
+		spdlog::details::log_msg msg(a_record.time, a_record.source, "Global", a_record.level, payload);
+		msg.thread_id = a_record.threadId;
+		target->log(msg);
+		counters.written.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// Returns how many records were written
+	std::size_t Drain() {
+		std::size_t written = 0;
+		LogRecord record;
+		while (queue.TryPop(record)) {
+			Write(record);
+			written += 1;
+		}
+		return written;
+	}
+
+	void Push(const LogRecord& a_record) {
+		if (!queue.TryPush(a_record)) {
+			counters.dropped.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	LogRecord MakeNote(std::uint32_t a_suppressed) {
+		LogRecord note;
+		const auto result = fmt::format_to_n(note.payload.data(), note.payload.size(), "{} lines from here suppressed in the last second", a_suppressed);
+		note.size = static_cast<std::uint32_t>(std::min(result.size, note.payload.size()));
+		return note;
+	}
+
+	void PushNote(const LogRecord& a_from, std::uint32_t a_suppressed) {
+		LogRecord note = MakeNote(a_suppressed);
+		note.level = a_from.level;
+		note.source = a_from.source;
+		note.time = a_from.time;
+		note.threadId = a_from.threadId;
+		Push(note);
+	}
+
+	// Log thread. A site that stops logging never reaches the note in Enqueue, write its count once its second is over.
+	// Returns whether any note was written
+	bool WriteQuietNotes() {
+		bool written = false;
+		const auto now = spdlog::log_clock::now();
+		const auto second = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
+		for (auto& site : sites) {
+			if (site.suppressed.load(std::memory_order_relaxed) == 0 || site.second.load(std::memory_order_relaxed) >= second) {
+				continue;
+			}
+			if (const std::uint32_t suppressed = site.suppressed.exchange(0, std::memory_order_relaxed); suppressed > 0) {
+				LogRecord note = MakeNote(suppressed);
+				note.level = site.level.load(std::memory_order_relaxed);
+				note.source = spdlog::source_loc(site.file.load(std::memory_order_relaxed), site.line.load(std::memory_order_relaxed), site.function.load(std::memory_order_relaxed));
+				note.time = now;
+				Write(note);
+				written = true;
+			}
+		}
+		return written;
+	}
+
+	// Returns once everything queued before the call is written and flushed
+	void FlushQueue() {
+		if (!workerRunning.load(std::memory_order_acquire)) {
+			// Nothing else consumes the queue yet
+			Drain();
+			target->flush();
+			return;
+		}
+		std::unique_lock lock(flushLock);
+		const std::uint64_t ticket = ++flushRequested;
+		flushWake.notify_one();
+		// Bounded so a stuck log thread can't hang the game
+		flushDone.wait_for(lock, std::chrono::seconds(1), [ticket]() {
+			return flushCompleted >= ticket;
+		});
+	}
+
+	void WorkerLoop() {
+		workerRunning.store(true, std::memory_order_release);
+		auto lastFlush = std::chrono::steady_clock::now();
+		auto lastNotes = lastFlush;
+		bool dirty = false;
+		while (true) {
+			if (Drain() > 0) {
+				dirty = true;
+				continue;
+			}
+
+			std::uint64_t requested = 0;
+			{
+				std::unique_lock lock(flushLock);
+				requested = flushRequested;
+			}
+			const auto now = std::chrono::steady_clock::now();
+			if (requested != flushCompleted) {
+				// Records pushed right before the request may have missed the drain above
+				Drain();
+				target->flush();
+				lastFlush = now;
+				dirty = false;
+				{
+					std::unique_lock lock(flushLock);
+					flushCompleted = requested;
+				}
+				flushDone.notify_all();
+				continue;
+			}
+			if (now - lastNotes > std::chrono::seconds(1)) {
+				dirty = WriteQuietNotes() || dirty;
+				lastNotes = now;
+			}
+			if (dirty && now - lastFlush > std::chrono::milliseconds(500)) {
+				target->flush();
+				lastFlush = now;
+				dirty = false;
+			}
+
+			std::unique_lock lock(flushLock);
+			flushWake.wait_for(lock, std::chrono::milliseconds(5), []() {
+				return flushRequested != flushCompleted;
+			});
+		}
+	}
+
+	// Front end for the logger, everything below it runs on the log thread
+	class AsyncSink final : public spdlog::sinks::base_sink<spdlog::details::null_mutex> {
+		protected:
+			void sink_it_(const spdlog::details::log_msg& a_msg) override {
+				const auto text = a_msg.payload;
+				if (text.size() > SKSE::log::detail::RecordPayload) {
+					// Rare and long (startup dumps and the like), keep it whole and write it out here after what is queued
+					FlushQueue();
+					target->log(a_msg);
+					counters.written.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+				LogRecord record;
+				record.level = a_msg.level;
+				record.source = a_msg.source;
+				record.time = a_msg.time;
+				record.threadId = a_msg.thread_id;
+				record.size = static_cast<std::uint32_t>(text.size());
+				std::memcpy(record.payload.data(), text.data(), text.size());
+				// Not rate limited, only the deferred_* sites opt into that
+				Push(record);
+			}
+
+			void flush_() override {
+				// Only reached for lines at the flush level (warn and up), wait until the log thread wrote everything queued before it
+				FlushQueue();
+			}
+
+			void set_pattern_(const std::string& a_pattern) override {
+				target->set_pattern(a_pattern);
+			}
+
+			void set_formatter_(std::unique_ptr<spdlog::formatter> a_formatter) override {
+				target->set_formatter(std::move(a_formatter));
+			}
+	};
+
 }
 
 namespace SKSE::log {
@@ -61,29 +288,33 @@ namespace SKSE::log {
 		*path /= PluginDeclaration::GetSingleton()->GetName();
 		*path += L".log";
 
-		std::shared_ptr <spdlog::logger> logger;
-
 		if (HasConsole()) {
-			logger = std::make_shared <spdlog::logger>("Global", std::make_shared <spdlog::sinks::stdout_color_sink_mt>());
-			logger->set_pattern(PatternConsole);
+			target = std::make_shared <spdlog::sinks::stdout_color_sink_mt>();
+			target->set_pattern(PatternConsole);
 		}
 		/*else if (IsDebuggerPresent()) {
-			logger = std::make_shared <spdlog::logger>("Global", std::make_shared <spdlog::sinks::msvc_sink_mt>());
-			logger->set_pattern(PatternDefault);
+			target = std::make_shared <spdlog::sinks::msvc_sink_mt>();
+			target->set_pattern(PatternDefault);
 		}*/
 		else {
-			logger = std::make_shared <spdlog::logger>("Global", std::make_shared <spdlog::sinks::basic_file_sink_mt>(path->string(), true));
-			logger->set_pattern(PatternDefault);
+			target = std::make_shared <spdlog::sinks::basic_file_sink_mt>(path->string(), true);
+			target->set_pattern(PatternDefault);
 		}
 
+		// The sink's pattern is already set, don't let the logger replace it
+		auto logger = std::make_shared <spdlog::logger>("Global", std::make_shared <AsyncSink>());
 		spdlog::set_default_logger(std::move(logger));
 		SetLevel("Info"); //Default level
 
+		// Never joined, whatever is still queued when the game exits is lost. Warnings and up are written synchronously
+		std::thread(WorkerLoop).detach();
+
 	}
 
 	void SetLevel(spdlog::level::level_enum a_level) {
 		spdlog::set_level(a_level);
-		spdlog::flush_on(a_level);
+		// Flushing waits for the log thread to catch up, only do that for lines that may precede a crash
+		spdlog::flush_on(std::max(a_level, spdlog::level::warn));
 	}
 
 	void SetLevel(const char* a_level) {
@@ -120,4 +351,62 @@ namespace SKSE::log {
 		}
 	}
 
-}
\ No newline at end of file
+	AsyncStats GetAsyncStats() {
+		return AsyncStats {
+			.written = counters.written.load(std::memory_order_relaxed),
+			.dropped = counters.dropped.load(std::memory_order_relaxed),
+			.rateLimited = counters.rateLimited.load(std::memory_order_relaxed),
+			.deduplicated = counters.deduplicated.load(std::memory_order_relaxed),
+		};
+	}
+
+	namespace detail {
+
+		bool Enqueue(LogRecord& a_record) {
+			if (a_record.level >= spdlog::level::warn) {
+				Push(a_record);
+				return true;
+			}
+
+			const std::uint64_t siteHash = HashBytes(&a_record.source.line, sizeof(a_record.source.line), HashBytes(&a_record.source.filename, sizeof(a_record.source.filename)));
+			auto& site = sites[siteHash % SiteCount];
+
+			const auto second = std::chrono::duration_cast<std::chrono::seconds>(a_record.time.time_since_epoch()).count();
+			std::int64_t previous = site.second.load(std::memory_order_relaxed);
+			if (previous != second && site.second.compare_exchange_strong(previous, second, std::memory_order_relaxed)) {
+				site.lines.store(0, std::memory_order_relaxed);
+				if (const std::uint32_t suppressed = site.suppressed.exchange(0, std::memory_order_relaxed); suppressed > 0) {
+					PushNote(a_record, suppressed);
+				}
+			}
+
+			const auto suppress = [&site, &a_record]() {
+				site.file.store(a_record.source.filename, std::memory_order_relaxed);
+				site.line.store(a_record.source.line, std::memory_order_relaxed);
+				site.function.store(a_record.source.funcname, std::memory_order_relaxed);
+				site.level.store(a_record.level, std::memory_order_relaxed);
+				site.suppressed.fetch_add(1, std::memory_order_relaxed);
+			};
+
+			// Same line from the same place as last time, only count it
+			std::uint64_t lineHash = HashBytes(a_record.payload.data(), a_record.size, HashBytes(&a_record.formatString, sizeof(a_record.formatString)));
+			if (site.lastHash.exchange(lineHash, std::memory_order_relaxed) == lineHash) {
+				suppress();
+				counters.deduplicated.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			if (site.lines.fetch_add(1, std::memory_order_relaxed) >= MaxLinesPerSite) {
+				suppress();
+				counters.rateLimited.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			if (!queue.TryPush(a_record)) {
+				counters.dropped.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			return true;
+		}
+	}
+}
@@ -1,5 +1,10 @@
 #pragma once
 
+// Logging goes through a bounded lock-free queue that a background thread writes out.
+// A full queue drops the line instead of stalling the game thread. Warnings and up are written out right away.
+// Each deferred_* call site may log 20 lines a second and repeats of the same line are folded and counted,
+// plain log::trace/debug/info lines are never held back.
+
 namespace SKSE::log {
 
 	void Initialize();
@@ -11,4 +16,89 @@ namespace SKSE::log {
 		return GetConsoleWindow() != nullptr;
 	}
 
-}
\ No newline at end of file
+	struct AsyncStats {
+		std::uint64_t written = 0;
+		std::uint64_t dropped = 0;
+		std::uint64_t rateLimited = 0;
+		std::uint64_t deduplicated = 0;
+	};
+
+	[[nodiscard]] AsyncStats GetAsyncStats();
+
+	namespace detail {
+
+		inline constexpr std::size_t RecordPayload = 224;
+
+		struct LogRecord {
+			using Formatter = void(*)(const LogRecord& a_record, fmt::memory_buffer& a_out);
+
+			// Null when the payload already holds the formatted text, otherwise the payload holds the packed arguments
+			Formatter format = nullptr;
+			const char* formatString = nullptr;
+			std::uint32_t formatSize = 0;
+			std::uint32_t size = 0;
+			spdlog::level::level_enum level = spdlog::level::info;
+			spdlog::source_loc source;
+			spdlog::log_clock::time_point time;
+			std::size_t threadId = 0;
+			alignas(8) std::array<char, RecordPayload> payload = {};
+		};
+
+		// Rate limited and folded per call site, false when the record was rate limited, folded or dropped
+		bool Enqueue(LogRecord& a_record);
+
+		template <class... Args>
+		void FormatPacked(const LogRecord& a_record, fmt::memory_buffer& a_out) {
+			std::tuple<Args...> args;
+			std::size_t offset = 0;
+			std::apply([&](auto&... a_args) {
+				((std::memcpy(&a_args, a_record.payload.data() + offset, sizeof(a_args)), offset += sizeof(a_args)), ...);
+			}, args);
+			std::apply([&](const auto&... a_args) {
+				fmt::format_to(std::back_inserter(a_out), fmt::runtime(std::string_view(a_record.formatString, a_record.formatSize)), a_args...);
+			}, args);
+		}
+
+		template <class... Args>
+		void EnqueueDeferred(spdlog::level::level_enum a_level, const std::source_location& a_loc, fmt::format_string<Args...> a_fmt, const Args&... a_args) {
+			static_assert((sizeof(Args) + ... + 0) <= RecordPayload, "Too many arguments for a deferred log line");
+			if (!spdlog::default_logger_raw()->should_log(a_level)) {
+				return;
+			}
+			LogRecord record;
+			record.format = &FormatPacked<Args...>;
+			const auto text = a_fmt.get();
+			record.formatString = text.data();
+			record.formatSize = static_cast<std::uint32_t>(text.size());
+			record.level = a_level;
+			record.source = spdlog::source_loc(a_loc.file_name(), static_cast<int>(a_loc.line()), a_loc.function_name());
+			record.time = spdlog::log_clock::now();
+			std::size_t offset = 0;
+			((std::memcpy(record.payload.data() + offset, &a_args, sizeof(a_args)), offset += sizeof(a_args)), ...);
+			record.size = static_cast<std::uint32_t>(offset);
+			Enqueue(record);
+		}
+	}
+
+	// Numbers and enums only, anything that points to other memory may be gone by the time the line is written
+	template <class T>
+	concept DeferrableArg = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+	// Same as log::trace/debug/info, but formatting happens on the log thread.
+	// Use these for lines that can fire every frame
+	#define GTS_DEFERRED_LOG(a_name, a_level)                                                                              \
+		template <DeferrableArg... Args>                                                                                    \
+		struct a_name {                                                                                                     \
+			a_name(fmt::format_string<Args...> a_fmt, Args... a_args, std::source_location a_loc = std::source_location::current()) { \
+				detail::EnqueueDeferred<Args...>(a_level, a_loc, a_fmt, a_args...);                                        \
+			}                                                                                                               \
+		};                                                                                                                  \
+		template <class... Args>                                                                                            \
+		a_name(fmt::format_string<Args...>, Args...) -> a_name<Args...>;
+
+	GTS_DEFERRED_LOG(deferred_trace, spdlog::level::trace)
+	GTS_DEFERRED_LOG(deferred_debug, spdlog::level::debug)
+	GTS_DEFERRED_LOG(deferred_info, spdlog::level::info)
+
+	#undef GTS_DEFERRED_LOG
+}
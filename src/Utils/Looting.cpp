@@ -1,4 +1,5 @@
 #include "Utils/Looting.hpp"
+#include "Utils/InventoryTransfer.hpp"
 
 #include "Config/Config.hpp"
 
@@ -171,25 +172,7 @@ namespace GTS {
 	}
 
 	void TransferInventory_Normal(Actor* giant, Actor* tiny, bool removeQuestItems) {
-		int32_t quantity = 1;
-
-		for (auto &[a_object, invData]: tiny->GetInventory()) { // transfer loot
-			if (a_object->GetPlayable() && a_object->GetFormType() != FormType::LeveledItem) {
-				if ((!invData.second->IsQuestObject() || removeQuestItems)) {
-
-					TESObjectREFR* ref = skyrim_cast<TESObjectREFR*>(tiny);
-					if (ref) {
-						auto changes = ref->GetInventoryChanges();
-						if (changes) {
-							quantity = GetItemCount(changes, a_object); // obtain item count
-						}
-					}
-
-
-					tiny->RemoveItem(a_object, quantity, ITEM_REMOVE_REASON::kRemove, nullptr, giant, nullptr, nullptr);
-				}
-			}
-		}
+		InventoryTransfer::Queue(tiny, giant, removeQuestItems); // transfer loot
 	}
 
 
@@ -252,26 +235,7 @@ namespace GTS {
 	}
 
 	void MoveItemsTowardsDropbox(Actor* actor, TESObjectREFR* dropbox, bool removeQuestItems) {
-		int32_t quantity = 1;
-		for (auto &[a_object, invData]: actor->GetInventory()) { // transfer loot
-			if (a_object->GetPlayable() && a_object->GetFormType() != FormType::LeveledItem) { // We don't want to move Leveled Items
-				if ((!invData.second->IsQuestObject() || removeQuestItems)) {
-
-					TESObjectREFR* ref = skyrim_cast<TESObjectREFR*>(actor);
-					if (ref) {
-						//log::info("Transfering item: {}, looking for quantity", a_object->GetName());
-						auto changes = ref->GetInventoryChanges();
-						if (changes) {
-							quantity = GetItemCount(changes, a_object); // obtain item count
-						}
-					}
-
-					//log::info("Transfering item: {}, quantity: {}", a_object->GetName(), quantity);
-
-					actor->RemoveItem(a_object, quantity, ITEM_REMOVE_REASON::kRemove, nullptr, dropbox, nullptr, nullptr);
-				}
-			}
-		}
+		InventoryTransfer::Queue(actor, dropbox, removeQuestItems); // transfer loot
 	}
 
 	void MoveItems(ActorHandle giantHandle, ActorHandle tinyHandle, FormID ID, DamageSource Cause) {
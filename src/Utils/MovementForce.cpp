@@ -1,5 +1,6 @@
 #include "Utils/MovementForce.hpp"
 #include "Config/Config.hpp"
+#include "Managers/Damage/ContactSnapshot.hpp"
 
 using namespace GTS;
 
@@ -70,12 +71,12 @@ namespace GTS {
 			auto Data = Transient::GetSingleton().GetData(a_Giant);
 
 			if (Data) {
-				NiAVObject* Node_LeftFoot = find_node(a_Giant, "NPC L Foot [Lft ]");
-				NiAVObject* Node_RightFoot = find_node(a_Giant, "NPC R Foot [Rft ]");
+				NiAVObject* Node_LeftFoot = ContactSnapshot::GetNode(a_Giant, ContactNode::FootL);
+				NiAVObject* Node_RightFoot = ContactSnapshot::GetNode(a_Giant, ContactNode::FootR);
 				
 				if (a_Giant->IsSneaking() || IsCrawling(a_Giant)) {
-					NiAVObject* Node_LeftHand = find_node(a_Giant, "NPC L Hand [LHnd]");
-					NiAVObject* Node_RightHand = find_node(a_Giant, "NPC R Hand [RHnd]");
+					NiAVObject* Node_LeftHand = ContactSnapshot::GetNode(a_Giant, ContactNode::HandL);
+					NiAVObject* Node_RightHand = ContactSnapshot::GetNode(a_Giant, ContactNode::HandR);
 					if (Node_LeftHand && Node_RightHand) {
 						Data->POSCurrentHandL = Node_LeftHand->world.translate;
 						Data->POSCurrentHandR = Node_RightHand->world.translate;
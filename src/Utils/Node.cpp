@@ -372,7 +372,7 @@ namespace GTS {
 			return nullptr;
 		}
 
-		std::regex the_regex(std::string(node_regex).c_str());
+		const TagPattern& pattern = GetTagPattern(node_regex);
 
 		// Game lookup failed we try and find it manually
 		std::deque<NiAVObject*> queue;
@@ -401,7 +401,7 @@ namespace GTS {
 					}
 
 					// Do smth
-					if (std::regex_match(currentnode->name.c_str(), the_regex)) {
+					if (pattern.Matches(currentnode->name.c_str())) {
 						return currentnode;
 					}
 
@@ -0,0 +1,169 @@
+#include "Utils/Random.hpp"
+#include "Managers/Console/ConsoleManager.hpp"
+#include "Profiler/Bench.hpp"
+
+#include "Config/Config.hpp"
+
+#include "ClibUtil/rng.hpp"
+
+namespace {
+
+	std::atomic<std::uint64_t> SessionSeed = 0;
+	// Bumped by SetSeed, threads compare it with the epoch they were seeded for
+	std::atomic<std::uint64_t> SeedEpoch = 1;
+	std::atomic<std::uint64_t> NextStream = 1;
+
+	struct ThreadGenerator {
+		GTS::Xoshiro256 engine;
+		std::uint64_t epoch = 0;
+		// 0 until the thread first reseeds off the main thread
+		std::uint64_t stream = 0;
+	};
+
+	std::uint64_t StreamSeed(std::uint64_t a_seed, std::uint64_t a_stream) {
+		// Golden ratio step keeps neighbouring streams apart, Seed() mixes the rest
+		return a_seed ^ (a_stream * 0x9E3779B97F4A7C15ull);
+	}
+
+	std::uint64_t FreshSeed() {
+		std::random_device device;
+		return (static_cast<std::uint64_t>(device()) << 32) | device();
+	}
+
+	std::optional<std::uint64_t> ParseSeed(const std::string& a_text) {
+		if (a_text.empty()) {
+			return std::nullopt;
+		}
+		std::uint64_t seed = 0;
+		const auto [end, error] = std::from_chars(a_text.data(), a_text.data() + a_text.size(), seed, 16);
+		if (error != std::errc() || end != a_text.data() + a_text.size()) {
+			log::warn("Random: sRandomSeed \"{}\" is not a hex number, ignoring it", a_text);
+			return std::nullopt;
+		}
+		return seed;
+	}
+
+	void CMD_RandomSeed() {
+		GTS::Cprint("Random seed: {:016X}", GTS::RandomService::GetSeed());
+	}
+}
+
+namespace GTS {
+
+	RandomService& RandomService::GetSingleton() noexcept {
+		static RandomService instance;
+		return instance;
+	}
+
+	std::string RandomService::DebugName() {
+		return "::RandomService";
+	}
+
+	void RandomService::DataReady() {
+		ConsoleManager::RegisterCommand("rngseed", CMD_RandomSeed, "Print the random seed of this session, put it in Advanced.sRandomSeed to replay it");
+		Bench::Register("random", Benchmark, "Time random draws against building a std distribution per call");
+	}
+
+	void RandomService::Reset() {
+		// Every load starts a new sequence so a report only has to name the seed of its session
+		const auto pinned = ParseSeed(Config::GetAdvanced().sRandomSeed);
+		SetSeed(pinned.value_or(FreshSeed()));
+		log::info("Random: Session seed {:016X}{}", GetSeed(), pinned ? " (pinned)" : "");
+	}
+
+	Xoshiro256& RandomService::GetGenerator() {
+		thread_local ThreadGenerator local;
+		const std::uint64_t epoch = SeedEpoch.load(std::memory_order_acquire);
+		if (local.epoch != epoch) {
+			// The main thread always uses stream 0 so its rolls replay regardless of thread start order
+			const bool mainThread = OnMainUpdateThread();
+			if (!mainThread && local.stream == 0) {
+				local.stream = NextStream.fetch_add(1);
+			}
+			local.engine.Seed(StreamSeed(SessionSeed.load(std::memory_order_relaxed), mainThread ? 0 : local.stream));
+			local.epoch = epoch;
+		}
+		return local.engine;
+	}
+
+	std::uint64_t RandomService::GetSeed() {
+		return SessionSeed.load(std::memory_order_relaxed);
+	}
+
+	void RandomService::SetSeed(std::uint64_t a_seed) {
+		SessionSeed.store(a_seed, std::memory_order_relaxed);
+		SeedEpoch.fetch_add(1, std::memory_order_release);
+	}
+
+	int RandomIntWeighted(std::span<const int> a_weights) {
+		std::int64_t total = 0;
+		for (int weight : a_weights) {
+			total += std::max(weight, 0);
+		}
+		if (total <= 0) {
+			return 0;
+		}
+		auto roll = static_cast<std::int64_t>(RandomBelow(static_cast<std::uint64_t>(total)));
+		for (std::size_t i = 0; i < a_weights.size(); i++) {
+			roll -= std::max(a_weights[i], 0);
+			if (roll < 0) {
+				return static_cast<int>(i);
+			}
+		}
+		return static_cast<int>(a_weights.size() - 1);
+	}
+
+	void RandomService::Benchmark() {
+		constexpr std::size_t Draws = 100000;
+
+		clib_util::RNG legacy(static_cast<std::uint32_t>(GetSeed()));
+		const std::vector<int> weights = { 10, 8, 6, 1, 25 };
+		const WeightedTable table(weights);
+
+		double sink = 0.0;
+
+		const double legacyFloat = Bench::TimeUs(Draws, [&]() {
+			std::uniform_real_distribution<> dist(0.0f, 1.0f);
+			sink += dist(legacy);
+		});
+		const double serviceFloat = Bench::TimeUs(Draws, [&]() {
+			sink += RandomFloat(0.0f, 1.0f);
+		});
+
+		std::array<float, 256> batch = {};
+		const double batchFloat = Bench::TimeUs(Draws / batch.size(), [&]() {
+			RandomFloats(batch, 0.0f, 1.0f);
+			sink += batch[0];
+		});
+
+		const double legacyInt = Bench::TimeUs(Draws, [&]() {
+			std::uniform_int_distribution<> dist(0, 16);
+			sink += dist(legacy);
+		});
+		const double serviceInt = Bench::TimeUs(Draws, [&]() {
+			sink += RandomInt(0, 16);
+		});
+
+		const double legacyWeighted = Bench::TimeUs(Draws, [&]() {
+			// The old RandomIntWeighted took the vector by value
+			std::vector<int> copy = weights;
+			std::discrete_distribution<> dist(copy.begin(), copy.end());
+			sink += dist(legacy);
+		});
+		const double serviceWeighted = Bench::TimeUs(Draws, [&]() {
+			sink += RandomIntWeighted(weights);
+		});
+
+		std::array<std::size_t, 5> picks = {};
+		const double aliasWeighted = Bench::TimeUs(Draws, [&]() {
+			picks[table.Pick()] += 1;
+		});
+
+		Cprint("--- Random Benchmark ({} draws) ---", Draws);
+		Cprint("Float: {:.1f} us per-call distribution, {:.1f} us service, {:.1f} us batched", legacyFloat, serviceFloat, batchFloat);
+		Cprint("Int: {:.1f} us per-call distribution, {:.1f} us service", legacyInt, serviceInt);
+		Cprint("Weighted: {:.1f} us discrete_distribution, {:.1f} us linear, {:.1f} us alias table", legacyWeighted, serviceWeighted, aliasWeighted);
+		Cprint("Alias picks (10/8/6/1/25): {} {} {} {} {}", picks[0], picks[1], picks[2], picks[3], picks[4]);
+		log::trace("Random benchmark sink {}", sink);
+	}
+}
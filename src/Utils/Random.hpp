@@ -1,94 +1,141 @@
-﻿#pragma once
+#pragma once
 
-#include "ClibUtil/rng.hpp"
+// Random numbers for gameplay rolls
+//
+// Every thread draws from its own xoshiro256** generator, all of them derived from one session seed.
+// The seed is logged on every load and can be pinned with Advanced.sRandomSeed to replay a reported sequence of rolls.
+
+#include "Utils/Xoshiro256.hpp"
+#include "Utils/WeightedTable.hpp"
 
 namespace GTS {
 
-	inline static std::random_device rdevice;
-	//inline static XoshiroCpp::Xoshiro256StarStar generator(rdevice());
-	inline static clib_util::RNG generator(rdevice());
+	class RandomService : public EventListener {
+		public:
+			[[nodiscard]] static RandomService& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void DataReady() override;
+			virtual void Reset() override;
+
+			// This thread's generator, reseeded on first use after the session seed changed
+			[[nodiscard]] static Xoshiro256& GetGenerator();
+			[[nodiscard]] static std::uint64_t GetSeed();
+			static void SetSeed(std::uint64_t a_seed);
+
+			static void Benchmark();
+	};
+
+	// ------------------
+	// Uniform
+	// -----------------
+
+	// [0, 1)
+	[[nodiscard]] inline double RandomUnit() {
+		return RandomService::GetGenerator().Unit();
+	}
+
+	// [0, a_bound), a_bound <= 2^32
+	[[nodiscard]] inline std::uint64_t RandomBelow(std::uint64_t a_bound) {
+		return RandomService::GetGenerator().Below(a_bound);
+	}
 
 	// ------------------
 	// Random Float
 	// -----------------
 
-	[[nodiscard]] static inline float RandomFloat(float a_min, float a_max) {
+	[[nodiscard]] inline float RandomFloat(float a_min, float a_max) {
 		// If min > max, swap them
 		if (a_min > a_max) {
 			std::swap(a_min, a_max);
 		}
+		return static_cast<float>(a_min + (static_cast<double>(a_max) - a_min) * RandomUnit());
+	}
 
-		std::uniform_real_distribution<> dist(a_min, a_max);
-		return static_cast<float>(dist(generator));
+	[[nodiscard]] inline float RandomFloat() {
+		return static_cast<float>(std::numeric_limits<float>::max() * RandomUnit());
 	}
 
-	[[nodiscard]] static inline float RandomFloat() {
-		std::uniform_real_distribution<> dist(0.f, std::numeric_limits<float>::max());
-		return static_cast<float>(dist(generator));
+	// Fills a_out with draws in [a_min, a_max), one generator lookup for the whole batch
+	inline void RandomFloats(std::span<float> a_out, float a_min, float a_max) {
+		if (a_min > a_max) {
+			std::swap(a_min, a_max);
+		}
+		auto& generator = RandomService::GetGenerator();
+		const double range = static_cast<double>(a_max) - a_min;
+		for (auto& value : a_out) {
+			value = static_cast<float>(a_min + range * generator.Unit());
+		}
 	}
 
 	// ------------------
 	// Random Int
 	// -----------------
 
-	[[nodiscard]] static inline int RandomInt(int a_min, int a_max) {
+	[[nodiscard]] inline int RandomInt(int a_min, int a_max) {
 
 		// If min > max, swap them
 		if (a_min > a_max) {
 			std::swap(a_min, a_max);
 		}
 
-		std::uniform_int_distribution<> dist(a_min, a_max);
-		return dist(generator);
+		const auto range = static_cast<std::uint64_t>(static_cast<std::int64_t>(a_max) - a_min) + 1;
+		return static_cast<int>(a_min + static_cast<std::int64_t>(RandomBelow(range)));
 	}
 
-	[[nodiscard]] static inline int RandomInt() {
-		std::uniform_int_distribution<> dist(0, INT_MAX);
-		return dist(generator);
+	[[nodiscard]] inline int RandomInt() {
+		return static_cast<int>(RandomService::GetGenerator()() >> 33);
 	}
 
-    [[nodiscard]] static inline int _RandomIntWeighted(std::initializer_list<int> a_weights) {
-        std::discrete_distribution<> dist(a_weights.begin(), a_weights.end());
-        return dist(generator);
-    }
+	// -------------------
+	// Weighted
+	// -------------------
+
+	//Example RandomIntWeighted(30,1,150) ->
+	// Adds all argumetns together then calculates odds given example numbers this will have a...
+	// 30 in 181 chance to return 0,
+	// 1 in 181 chance to return 1
+	// 150 in 181 chance to return 2
+	/// x in nSum chance to return n[i]
+	/// All zero weights always return 0, same as std::discrete_distribution
+	[[nodiscard]] int RandomIntWeighted(std::span<const int> a_weights);
 
-	[[nodiscard]] static inline int RandomIntWeighted(std::vector<int> a_weights) {
-		std::discrete_distribution<> dist(a_weights.begin(), a_weights.end());
-		return dist(generator);
+	[[nodiscard]] inline int RandomIntWeighted(std::initializer_list<int> a_weights) {
+		return RandomIntWeighted(std::span<const int>(a_weights.begin(), a_weights.size()));
 	}
 
+	[[nodiscard]] inline int RandomIntWeighted(const std::vector<int>& a_weights) {
+		return RandomIntWeighted(std::span<const int>(a_weights));
+	}
 
 	template <std::size_t N>
-	[[nodiscard]] static inline int RandomIntWeighted(const std::array<int, N>& a_weights) {
-		std::discrete_distribution<> dist(a_weights.begin(), a_weights.end());
-		return dist(generator);
+	[[nodiscard]] inline int RandomIntWeighted(const std::array<int, N>& a_weights) {
+		return RandomIntWeighted(std::span<const int>(a_weights));
 	}
 
-	//https://en.cppreference.com/w/cpp/numeric/random/discrete_distribution
-	//Example RandomIntWeighted(30,1,150) -> 
-	// Adds all argumetns together then calculates odds given example numbers this will have a...
-	// 30 in 181 chance to return 0,
-	// 1 in 181 chance to return 1
-	// 150 in 181 chance to return 2
-	/// x in nSum chance to return n[i]
-    template <typename... Args>
-    [[nodiscard]] static inline int RandomIntWeighted(Args... a_weights) {
-        return _RandomIntWeighted({ a_weights... });
-    }
+	template <std::integral... Args>
+	[[nodiscard]] inline int RandomIntWeighted(Args... a_weights) {
+		const std::array<int, sizeof...(Args)> weights = { static_cast<int>(a_weights)... };
+		return RandomIntWeighted(std::span<const int>(weights));
+	}
+
+	// Draws from this thread's generator
+	inline int WeightedTable::Pick() const {
+		return this->Pick(RandomService::GetGenerator());
+	}
 
 	// -------------------
 	// Random Bool Chance
 	// -------------------
 
 	/// <summary>
-	/// Use Bernouli distribution to generate a random boolean
+	/// Generate a random boolean
 	/// </summary>
 	/// <param name="a_trueChance">0-100 chance for the value to be true, 0 is always false 100 is always true</param>
 	/// <returns>true or false</returns>
-	[[nodiscard]] static inline int RandomBool(const float a_trueChance = 50.0f) {
-		const float probability = a_trueChance / 100.0f;
-		std::bernoulli_distribution dist(probability);
-		return dist(generator);
+	[[nodiscard]] inline int RandomBool(const float a_trueChance = 50.0f) {
+		const double probability = a_trueChance / 100.0;
+		return RandomUnit() < probability;
 	}
 
 	// -------------------
@@ -96,14 +143,13 @@ namespace GTS {
 	// -------------------
 
 	//https://en.cppreference.com/w/cpp/numeric/random/normal_distribution
-	[[nodiscard]] static inline float RandomFloatGauss(float a_mean, float a_deviation) {
+	[[nodiscard]] inline float RandomFloatGauss(float a_mean, float a_deviation) {
 		std::normal_distribution <> dist(a_mean, a_deviation);
-		return static_cast<float>(dist(generator));
+		return static_cast<float>(dist(RandomService::GetGenerator()));
 	}
 
-	[[nodiscard]] static inline int RandomIntGauss(int a_mean, int a_deviation) {
+	[[nodiscard]] inline int RandomIntGauss(int a_mean, int a_deviation) {
 		std::normal_distribution <> dist(a_mean, a_deviation);
-		return static_cast<int>(dist(generator));
+		return static_cast<int>(dist(RandomService::GetGenerator()));
 	}
 }
-
@@ -0,0 +1,173 @@
+#include "Utils/TagClassifier.hpp"
+#include "Managers/Console/ConsoleManager.hpp"
+#include "Profiler/Bench.hpp"
+
+namespace {
+
+	// Vanilla tags, used by the benchmark when nothing has been recorded yet
+	constexpr std::array<std::string_view, 12> SampleTags = {
+		"FootLeft",
+		"FootRight",
+		"FootSprintLeft",
+		"FootSprintRight",
+		"FootFront",
+		"FootBack",
+		"FootScuffLeft",
+		"FootScuffRight",
+		"JumpUp",
+		"JumpDown",
+		"JumpFall",
+		"SoundPlay.NPCHumanCombatIdle",
+	};
+}
+
+namespace GTS {
+
+	FootTagClassifier& FootTagClassifier::GetSingleton() noexcept {
+		static FootTagClassifier instance;
+		return instance;
+	}
+
+	std::string FootTagClassifier::DebugName() {
+		return "::FootTagClassifier";
+	}
+
+	void FootTagClassifier::DataReady() {
+		Bench::Register("tags", Benchmark, "Compare the tag classifier with std::regex, the first run starts recording footstep tags for the next one");
+	}
+
+	std::uint8_t FootTagClassifier::ClassifyUncached(std::string_view a_tag) {
+		static const std::array<std::pair<TagPattern, FootTag>, 6> Patterns = {{
+			{ TagPattern(".*Foot.*Left.*"), FootTag::FootLeft },
+			{ TagPattern(".*Foot.*Right.*"), FootTag::FootRight },
+			{ TagPattern(".*Foot.*Front.*"), FootTag::FootFront },
+			{ TagPattern(".*Foot.*Back.*"), FootTag::FootBack },
+			{ TagPattern(".*Sprint.*"), FootTag::Sprint },
+			{ TagPattern(".*Jump.*(Down|Land).*"), FootTag::JumpLand },
+		}};
+
+		std::uint8_t result = static_cast<std::uint8_t>(FootTag::None);
+		for (const auto& [pattern, flag] : Patterns) {
+			if (pattern.Matches(a_tag)) {
+				result |= static_cast<std::uint8_t>(flag);
+			}
+		}
+		return result;
+	}
+
+	std::uint8_t FootTagClassifier::Classify(const BSFixedString& a_tag) {
+		const char* key = a_tag.data();
+		if (!key) {
+			return static_cast<std::uint8_t>(FootTag::None);
+		}
+
+		auto& self = FootTagClassifier::GetSingleton();
+		{
+			std::shared_lock guard(self.lock);
+			if (auto it = self.memo.find(key); it != self.memo.end()) {
+				return it->second.second;
+			}
+		}
+
+		const std::uint8_t result = FootTagClassifier::ClassifyUncached(a_tag.c_str());
+		std::unique_lock guard(self.lock);
+		self.memo.try_emplace(key, a_tag, result);
+		return result;
+	}
+
+	void FootTagClassifier::Record(const BSFixedString& a_tag) {
+		if (!Capturing.load(std::memory_order_relaxed)) {
+			return;
+		}
+		auto& self = FootTagClassifier::GetSingleton();
+		std::unique_lock guard(self.recordLock);
+		self.recorded[self.recordedCount % RecordSize] = a_tag;
+		self.recordedCount += 1;
+	}
+
+	void FootTagClassifier::Benchmark() {
+		constexpr std::size_t Rounds = 20;
+
+		auto& self = FootTagClassifier::GetSingleton();
+		std::vector<BSFixedString> stream;
+		{
+			std::unique_lock guard(self.recordLock);
+			const std::size_t count = std::min(self.recordedCount, RecordSize);
+			stream.assign(self.recorded.begin(), self.recorded.begin() + count);
+		}
+		// First run starts capturing real tags, the next run replays them and stops
+		const bool captured = !stream.empty();
+		Capturing.store(!captured, std::memory_order_relaxed);
+		if (!captured) {
+			for (const auto& tag : SampleTags) {
+				stream.emplace_back(tag);
+			}
+		}
+
+		constexpr std::array<std::pair<std::string_view, FootTag>, 6> Sources = {{
+			{ ".*Foot.*Left.*", FootTag::FootLeft },
+			{ ".*Foot.*Right.*", FootTag::FootRight },
+			{ ".*Foot.*Front.*", FootTag::FootFront },
+			{ ".*Foot.*Back.*", FootTag::FootBack },
+			{ ".*Sprint.*", FootTag::Sprint },
+			{ ".*Jump.*(Down|Land).*", FootTag::JumpLand },
+		}};
+
+		// The old matches() built the regex on every call
+		auto perCallRegex = [&Sources](std::string_view a_tag) {
+			std::uint8_t result = 0;
+			for (const auto& [source, flag] : Sources) {
+				if (std::regex_match(std::string(a_tag), std::regex(std::string(source)))) {
+					result |= static_cast<std::uint8_t>(flag);
+				}
+			}
+			return result;
+		};
+
+		std::vector<std::pair<std::regex, FootTag>> compiled;
+		for (const auto& [source, flag] : Sources) {
+			compiled.emplace_back(std::regex(std::string(source)), flag);
+		}
+		auto compiledRegex = [&compiled](std::string_view a_tag) {
+			std::uint8_t result = 0;
+			for (const auto& [regex, flag] : compiled) {
+				if (std::regex_match(a_tag.begin(), a_tag.end(), regex)) {
+					result |= static_cast<std::uint8_t>(flag);
+				}
+			}
+			return result;
+		};
+
+		std::uint64_t sink = 0;
+		auto pass = [&](auto&& a_classify) {
+			return Bench::TimeUs(Rounds, [&]() {
+				for (const auto& tag : stream) {
+					sink += a_classify(tag);
+				}
+			});
+		};
+		const double perCallUs = pass([&](const BSFixedString& a_tag) { return perCallRegex(a_tag.c_str()); });
+		const double compiledUs = pass([&](const BSFixedString& a_tag) { return compiledRegex(a_tag.c_str()); });
+		const double patternUs = pass([](const BSFixedString& a_tag) { return ClassifyUncached(a_tag.c_str()); });
+		const double memoUs = pass([](const BSFixedString& a_tag) { return Classify(a_tag); });
+
+		std::size_t mismatches = 0;
+		for (const auto& tag : stream) {
+			if (compiledRegex(tag.c_str()) != Classify(tag)) {
+				mismatches += 1;
+				log::warn("FootTagClassifier: \"{}\" classified differently than std::regex", tag.c_str());
+			}
+		}
+
+		const double events = static_cast<double>(stream.size() * Rounds);
+		Cprint("--- Footstep Tag Benchmark ({} {} tags x {}) ---", stream.size(), captured ? "recorded" : "sample", Rounds);
+		Cprint("std::regex per call: {:.1f} ns/event", perCallUs * 1000.0 / events);
+		Cprint("std::regex compiled: {:.1f} ns/event", compiledUs * 1000.0 / events);
+		Cprint("TagPattern: {:.1f} ns/event", patternUs * 1000.0 / events);
+		Cprint("Memoized: {:.1f} ns/event", memoUs * 1000.0 / events);
+		Cprint("Mismatches against std::regex: {} (checksum {})", mismatches, sink);
+		if (!captured) {
+			Cprint("Now recording footstep tags, run benchtags again after walking around to replay them");
+		}
+	}
+}
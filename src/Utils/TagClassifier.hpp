@@ -0,0 +1,52 @@
+#pragma once
+#include "Utils/TagPattern.hpp"
+
+// Footstep tag classification without std::regex, patterns are matched with TagPattern
+
+namespace GTS {
+
+	enum class FootTag : std::uint8_t {
+		None = 0,
+		FootLeft = 1 << 0,   // .*Foot.*Left.*
+		FootRight = 1 << 1,  // .*Foot.*Right.*
+		FootFront = 1 << 2,  // .*Foot.*Front.*
+		FootBack = 1 << 3,   // .*Foot.*Back.*
+		Sprint = 1 << 4,     // .*Sprint.*
+		JumpLand = 1 << 5,   // .*Jump.*(Down|Land).*
+	};
+
+	class FootTagClassifier : public EventListener {
+		public:
+			[[nodiscard]] static FootTagClassifier& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void DataReady() override;
+
+			// Classifies a footstep / annotation tag.
+			// BSFixedStrings are interned, so results are memoized by the string's data pointer
+			static std::uint8_t Classify(const BSFixedString& a_tag);
+			static std::uint8_t ClassifyUncached(std::string_view a_tag);
+
+			static bool Has(std::uint8_t a_tags, FootTag a_flag) {
+				return (a_tags & static_cast<std::uint8_t>(a_flag)) != 0;
+			}
+
+			// Keeps the last footstep tags seen in game so the benchmark can replay them.
+			// Does nothing until benchtags turns capturing on
+			static void Record(const BSFixedString& a_tag);
+			static void Benchmark();
+
+		private:
+			static constexpr std::size_t RecordSize = 512;
+
+			std::shared_mutex lock;
+			// Holding the string keeps its pool entry alive, so the pointer can't be reused by another tag
+			std::unordered_map<const char*, std::pair<BSFixedString, std::uint8_t>> memo;
+
+			static inline std::atomic<bool> Capturing = false;
+
+			std::mutex recordLock;
+			std::array<BSFixedString, RecordSize> recorded;
+			std::size_t recordedCount = 0;
+	};
+}
@@ -0,0 +1,142 @@
+#include "Utils/TagPattern.hpp"
+
+namespace {
+
+	constexpr std::string_view MetaChars = ".*+?()[]{}|^$\\";
+
+	bool IsMeta(char a_char) {
+		return MetaChars.find(a_char) != std::string_view::npos;
+	}
+}
+
+namespace GTS {
+
+	TagPattern::TagPattern(std::string_view a_pattern) {
+		if (!this->Parse(a_pattern)) {
+			this->elements.clear();
+			try {
+				this->fallback.emplace(std::string(a_pattern));
+			} catch (const std::regex_error& e) {
+				log::warn("TagPattern: Invalid pattern {}: {}", a_pattern, e.what());
+				this->fallback.reset();
+			}
+		}
+	}
+
+	bool TagPattern::Parse(std::string_view a_pattern) {
+		std::string literal;
+		auto flush = [&]() {
+			if (!literal.empty()) {
+				this->elements.push_back(Element{ false, { std::move(literal) } });
+				literal.clear();
+			}
+		};
+
+		std::size_t i = 0;
+		while (i < a_pattern.size()) {
+			const char c = a_pattern[i];
+			if (c == '\\') {
+				if (i + 1 >= a_pattern.size() || std::isalnum(static_cast<unsigned char>(a_pattern[i + 1]))) {
+					return false; // \d, \w and friends are classes, not literals
+				}
+				literal.push_back(a_pattern[i + 1]);
+				i += 2;
+			} else if (c == '.' && i + 1 < a_pattern.size() && a_pattern[i + 1] == '*') {
+				flush();
+				if (this->elements.empty() || !this->elements.back().wildcard) {
+					this->elements.push_back(Element{ true, {} });
+				}
+				i += 2;
+			} else if (c == '(') {
+				flush();
+				const auto close = a_pattern.find(')', i);
+				if (close == std::string_view::npos) {
+					return false;
+				}
+				Element group;
+				std::string alternative;
+				for (std::size_t j = i + 1; j < close; ++j) {
+					const char g = a_pattern[j];
+					if (g == '|') {
+						group.alternatives.push_back(std::move(alternative));
+						alternative.clear();
+					} else if (IsMeta(g)) {
+						return false;
+					} else {
+						alternative.push_back(g);
+					}
+				}
+				group.alternatives.push_back(std::move(alternative));
+				this->elements.push_back(std::move(group));
+				i = close + 1;
+			} else if (IsMeta(c)) {
+				return false;
+			} else {
+				literal.push_back(c);
+				i += 1;
+			}
+		}
+		flush();
+		return true;
+	}
+
+	bool TagPattern::IsCompiled() const {
+		return !this->fallback.has_value();
+	}
+
+	bool TagPattern::Matches(std::string_view a_str) const {
+		if (this->fallback) {
+			return std::regex_match(a_str.begin(), a_str.end(), *this->fallback);
+		}
+		return this->MatchFrom(0, a_str, 0, false);
+	}
+
+	// Small backtracking matcher, patterns here are a handful of elements and tags are short
+	bool TagPattern::MatchFrom(std::size_t a_element, std::string_view a_str, std::size_t a_pos, bool a_floating) const {
+		if (a_element == this->elements.size()) {
+			return a_floating || a_pos == a_str.size();
+		}
+
+		const auto& element = this->elements[a_element];
+		if (element.wildcard) {
+			return this->MatchFrom(a_element + 1, a_str, a_pos, true);
+		}
+
+		for (const auto& alternative : element.alternatives) {
+			if (a_floating) {
+				auto found = a_str.find(alternative, a_pos);
+				while (found != std::string_view::npos) {
+					if (this->MatchFrom(a_element + 1, a_str, found + alternative.size(), false)) {
+						return true;
+					}
+					found = a_str.find(alternative, found + 1);
+				}
+			} else if (a_str.substr(a_pos).starts_with(alternative)) {
+				if (this->MatchFrom(a_element + 1, a_str, a_pos + alternative.size(), false)) {
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	const TagPattern& GetTagPattern(std::string_view a_pattern) {
+		static std::shared_mutex lock;
+		static std::unordered_map<std::string, std::unique_ptr<TagPattern>> patterns;
+
+		std::string key(a_pattern);
+		{
+			std::shared_lock guard(lock);
+			if (auto it = patterns.find(key); it != patterns.end()) {
+				return *it->second;
+			}
+		}
+
+		std::unique_lock guard(lock);
+		auto [it, inserted] = patterns.try_emplace(key, nullptr);
+		if (inserted) {
+			it->second = std::make_unique<TagPattern>(a_pattern);
+		}
+		return *it->second;
+	}
+}
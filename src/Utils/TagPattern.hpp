@@ -0,0 +1,34 @@
+#pragma once
+
+// Tag matching without std::regex
+//
+// TagPattern understands the small regex subset used for tags and node names:
+// literals, escaped literals (\[), ".*" wildcards and literal alternation groups "(Down|Land)".
+// Anything outside of that subset falls back to a cached std::regex.
+
+namespace GTS {
+
+	class TagPattern {
+		public:
+			explicit TagPattern(std::string_view a_pattern);
+
+			// Same semantics as std::regex_match (whole string must match)
+			bool Matches(std::string_view a_str) const;
+			bool IsCompiled() const;
+
+		private:
+			struct Element {
+				bool wildcard = false;
+				std::vector<std::string> alternatives;
+			};
+
+			bool Parse(std::string_view a_pattern);
+			bool MatchFrom(std::size_t a_element, std::string_view a_str, std::size_t a_pos, bool a_floating) const;
+
+			std::vector<Element> elements;
+			std::optional<std::regex> fallback;
+	};
+
+	// Returns a compiled pattern, patterns are compiled once and kept for the rest of the session
+	const TagPattern& GetTagPattern(std::string_view a_pattern);
+}
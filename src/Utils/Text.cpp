@@ -1,4 +1,5 @@
 #include "Utils/Text.hpp"
+#include "Utils/TagClassifier.hpp"
 
 namespace GTS {
 
@@ -7,8 +8,7 @@ namespace GTS {
 	}
 
 	bool matches(std::string_view str, std::string_view reg) {
-		std::regex the_regex(std::string(reg).c_str());
-		return std::regex_match(std::string(str), the_regex);
+		return GetTagPattern(reg).Matches(str);
 	}
 
 	std::string str_tolower(std::string s) {
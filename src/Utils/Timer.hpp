@@ -22,4 +22,35 @@ namespace GTS {
 		std::uint64_t last_frame = 0;
 		std::uint64_t elaped_frame = 0;
 	};
+
+	// Erases stale entries from a per-actor cache at most every few seconds, call it from Update every frame.
+	// Keeps entries of actors that unloaded from piling up
+	class PeriodicPrune {
+		public:
+		explicit PeriodicPrune(double a_interval = 5.0) : timer(a_interval) {}
+
+		// Returns true when it ran this frame
+		template <class Container, class Predicate>
+		bool operator()(Container& a_container, Predicate&& a_stale) {
+			if (!this->timer.ShouldRunFrame()) {
+				return false;
+			}
+			std::erase_if(a_container, std::forward<Predicate>(a_stale));
+			return true;
+		}
+
+		// Same, but only takes a_lock when the prune actually runs
+		template <class Container, class Predicate, class Mutex>
+		bool operator()(Container& a_container, Predicate&& a_stale, Mutex& a_lock) {
+			if (!this->timer.ShouldRunFrame()) {
+				return false;
+			}
+			std::unique_lock guard(a_lock);
+			std::erase_if(a_container, std::forward<Predicate>(a_stale));
+			return true;
+		}
+
+		private:
+		Timer timer;
+	};
 }
@@ -0,0 +1,151 @@
+#include "Utils/TimerManager.hpp"
+#include "Managers/Console/ConsoleManager.hpp"
+#include "Profiler/Bench.hpp"
+
+namespace {
+
+	// Small deterministic generator so benchmark runs are comparable
+	std::uint32_t BenchRand(std::uint32_t& a_state) {
+		a_state = a_state * 1664525u + 1013904223u;
+		return a_state >> 8;
+	}
+
+	void CMD_BenchmarkTimers() {
+		GTS::TimerManager::Benchmark(10000);
+	}
+}
+
+namespace GTS {
+
+	TimerManager& TimerManager::GetSingleton() noexcept {
+		static TimerManager instance;
+		return instance;
+	}
+
+	std::string TimerManager::DebugName() {
+		return "::TimerManager";
+	}
+
+	void TimerManager::DataReady() {
+		Bench::Register("timers", CMD_BenchmarkTimers, "Stress test the timing wheel with 10k timers");
+	}
+
+	void TimerManager::Update() {
+		this->wheel.Advance(Time::WorldTimeElapsed());
+	}
+
+	void TimerManager::Reset() {
+		this->wheel.Clear();
+		this->named.clear();
+	}
+
+	TimerID TimerManager::After(double a_delay, std::function<void()> a_callback) {
+		return GetSingleton().wheel.After(a_delay, [callback = std::move(a_callback)]() {
+			callback();
+			return false;
+		});
+	}
+
+	TimerID TimerManager::After(std::string_view a_name, double a_delay, std::function<void()> a_callback) {
+		auto& me = GetSingleton();
+		if (IsPending(a_name)) {
+			return me.named.at(std::string(a_name));
+		}
+		std::string name(a_name);
+		TimerID handle = me.wheel.After(a_delay, [name, callback = std::move(a_callback)]() {
+			GetSingleton().named.erase(name);
+			callback();
+			return false;
+		});
+		me.named.insert_or_assign(std::move(name), handle);
+		return handle;
+	}
+
+	bool TimerManager::Cancel(TimerID a_handle) {
+		return GetSingleton().wheel.Cancel(a_handle);
+	}
+
+	void TimerManager::Cancel(std::string_view a_name) {
+		auto& me = GetSingleton();
+		auto it = me.named.find(std::string(a_name));
+		if (it != me.named.end()) {
+			me.wheel.Cancel(it->second);
+			me.named.erase(it);
+		}
+	}
+
+	bool TimerManager::IsPending(std::string_view a_name) {
+		auto& me = GetSingleton();
+		auto it = me.named.find(std::string(a_name));
+		if (it == me.named.end()) {
+			return false;
+		}
+		if (!me.wheel.IsPending(it->second)) {
+			me.named.erase(it);
+			return false;
+		}
+		return true;
+	}
+
+	void TimerManager::Benchmark(std::size_t a_count) {
+		constexpr double FrameTime = 1.0 / 60.0;
+		constexpr double Horizon = 60.0;
+
+		std::uint32_t seed = 0x5EED;
+		std::vector<double> delays(a_count);
+		for (auto& delay : delays) {
+			delay = (BenchRand(seed) % 100000) * (Horizon / 100000.0);
+		}
+
+		// Timing wheel
+		TimingWheel bench(0.0);
+		std::vector<TimerID> handles;
+		handles.reserve(a_count);
+		std::size_t fired = 0;
+
+		const double scheduleUs = Bench::TimeUs(1, [&]() {
+			for (double delay : delays) {
+				handles.push_back(bench.After(delay, [&fired]() {
+					fired++;
+					return false;
+				}));
+			}
+		});
+
+		const double cancelUs = Bench::TimeUs(1, [&]() {
+			for (std::size_t i = 0; i < handles.size(); i += 10) {
+				bench.Cancel(handles[i]);
+			}
+		});
+
+		std::size_t frames = 0;
+		const double advanceUs = Bench::TimeUs(1, [&]() {
+			for (double now = 0.0; now <= Horizon + 1.0; now += FrameTime) {
+				bench.Advance(now);
+				frames++;
+			}
+		});
+
+		// Polling baseline, what every Timer / timestamp task does today
+		std::vector<double> deadlines = delays;
+		std::vector<bool> done(a_count, false);
+		std::size_t polled = 0;
+		const double pollUs = Bench::TimeUs(1, [&]() {
+			for (double now = 0.0; now <= Horizon + 1.0; now += FrameTime) {
+				for (std::size_t i = 0; i < deadlines.size(); i++) {
+					if (!done[i] && deadlines[i] <= now) {
+						done[i] = true;
+						polled++;
+					}
+				}
+			}
+		});
+
+		const double count = static_cast<double>(a_count);
+		Cprint("--- Timing Wheel Benchmark ({} timers, {} frames) ---", a_count, frames);
+		Cprint("Schedule: {:.1f} ns/timer", scheduleUs * 1000.0 / count);
+		Cprint("Cancel: {:.1f} ns/timer", cancelUs * 1000.0 / std::max(count / 10.0, 1.0));
+		Cprint("Wheel Advance: {:.1f} ns/frame, fired {}", advanceUs * 1000.0 / frames, fired);
+		Cprint("Polling: {:.1f} ns/frame, fired {}", pollUs * 1000.0 / frames, polled);
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "Utils/TimingWheel.hpp"
+
+namespace GTS {
+
+	// Central timer service driven by Time::WorldTimeElapsed()
+	// Use this instead of a TaskManager lambda that only waits for a timestamp.
+	// Timer::ShouldRun throttles and CooldownManager stay as they are, both are a single compare done only when asked
+	class TimerManager : public EventListener {
+		public:
+			[[nodiscard]] static TimerManager& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void DataReady() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+
+			// Run the callback once after a_delay seconds of world time
+			static TimerID After(double a_delay, std::function<void()> a_callback);
+			// Named variant, does nothing if a timer with this name is already pending (same as TaskManager::Run)
+			static TimerID After(std::string_view a_name, double a_delay, std::function<void()> a_callback);
+
+			static bool Cancel(TimerID a_handle);
+			static void Cancel(std::string_view a_name);
+			static bool IsPending(std::string_view a_name);
+
+			// Stress test with a standalone wheel, reports through the console
+			static void Benchmark(std::size_t a_count);
+
+		private:
+			TimingWheel wheel;
+			std::unordered_map<std::string, TimerID> named;
+	};
+}
@@ -0,0 +1,263 @@
+#include "Utils/TimingWheel.hpp"
+
+namespace {
+
+	constexpr std::uint64_t SlotMask = GTS::TimingWheel::SlotCount - 1;
+
+	constexpr std::uint32_t LevelShift(std::uint32_t a_level) {
+		return GTS::TimingWheel::SlotBits * a_level;
+	}
+
+	constexpr GTS::TimerID MakeHandle(std::uint32_t a_index, std::uint32_t a_generation) {
+		return (static_cast<std::uint64_t>(a_generation) << 32) | (static_cast<std::uint64_t>(a_index) + 1);
+	}
+}
+
+namespace GTS {
+
+	TimingWheel::TimingWheel(double a_now) : currentTick(ToTicks(a_now)), now(a_now) {
+		for (auto& level : this->slots) {
+			level.fill(npos);
+		}
+	}
+
+	TimerID TimingWheel::After(double a_delay, Callback a_callback) {
+		return this->Schedule(a_delay, 0.0, std::move(a_callback));
+	}
+
+	TimerID TimingWheel::Every(double a_interval, Callback a_callback) {
+		return this->Schedule(a_interval, std::max(a_interval, TickSeconds), std::move(a_callback));
+	}
+
+	bool TimingWheel::Cancel(TimerID a_handle) {
+		Node* node = this->Resolve(a_handle);
+		if (!node) {
+			return false;
+		}
+		std::uint32_t index = static_cast<std::uint32_t>((a_handle & 0xFFFFFFFF) - 1);
+		if (node->level != kFiring) {
+			this->Unlink(index);
+		}
+		// Nodes that are currently firing are skipped by FireSlot through the generation bump
+		this->Release(index);
+		return true;
+	}
+
+	bool TimingWheel::IsPending(TimerID a_handle) const {
+		return this->Resolve(a_handle) != nullptr;
+	}
+
+	void TimingWheel::Advance(double a_now) {
+		this->now = std::max(this->now, a_now);
+		const std::uint64_t target = ToTicks(this->now);
+
+		// Nothing scheduled, no reason to walk the empty slots
+		if (this->pending == 0) {
+			this->currentTick = std::max(this->currentTick, target);
+			return;
+		}
+
+		while (this->currentTick < target) {
+			const std::uint64_t tick = ++this->currentTick;
+
+			// Higher levels first so anything they drop into a lower level that is also due gets cascaded too
+			for (std::uint32_t level = LevelCount - 1; level > 0; level--) {
+				const std::uint64_t mask = (1ull << LevelShift(level)) - 1;
+				if ((tick & mask) == 0) {
+					this->Cascade(level);
+				}
+			}
+
+			this->FireSlot(static_cast<std::uint32_t>(tick & SlotMask));
+
+			if (this->pending == 0) {
+				this->currentTick = target;
+				break;
+			}
+		}
+	}
+
+	void TimingWheel::Clear() {
+		// Release instead of dropping the pool so stale handles keep failing to resolve
+		for (std::uint32_t index = 0; index < this->nodes.size(); index++) {
+			if (this->nodes[index].level != kFree) {
+				this->Release(index);
+			}
+		}
+		for (auto& level : this->slots) {
+			level.fill(npos);
+		}
+	}
+
+	std::size_t TimingWheel::Pending() const {
+		return this->pending;
+	}
+
+	TimerID TimingWheel::Schedule(double a_delay, double a_interval, Callback a_callback) {
+		if (!a_callback) {
+			return 0;
+		}
+		std::uint32_t index = this->Allocate();
+		Node& node = this->nodes[index];
+		node.callback = std::move(a_callback);
+		node.due = this->now + std::max(a_delay, 0.0);
+		node.interval = a_interval;
+		node.deadline = ToTicks(node.due);
+		this->Insert(index);
+		return MakeHandle(index, node.generation);
+	}
+
+	std::uint32_t TimingWheel::Allocate() {
+		this->pending++;
+		if (!this->freeList.empty()) {
+			std::uint32_t index = this->freeList.back();
+			this->freeList.pop_back();
+			return index;
+		}
+		this->nodes.emplace_back();
+		return static_cast<std::uint32_t>(this->nodes.size() - 1);
+	}
+
+	void TimingWheel::Release(std::uint32_t a_index) {
+		Node& node = this->nodes[a_index];
+		node.callback = nullptr;
+		node.prev = npos;
+		node.next = npos;
+		node.level = kFree;
+		// Generation 0 is reserved so a zeroed handle never resolves
+		node.generation = node.generation == std::numeric_limits<std::uint32_t>::max() ? 1 : node.generation + 1;
+		this->freeList.push_back(a_index);
+		this->pending--;
+	}
+
+	void TimingWheel::Insert(std::uint32_t a_index) {
+		Node& node = this->nodes[a_index];
+		const std::uint64_t due = std::max(node.deadline, this->currentTick + 1);
+
+		// A timer lives in the lowest level whose higher bits already match the current tick.
+		// When those bits roll over the slot is cascaded down and the timer is re-sorted.
+		std::uint32_t level = 0;
+		for (; level < LevelCount - 1; level++) {
+			if ((due >> LevelShift(level + 1)) == (this->currentTick >> LevelShift(level + 1))) {
+				break;
+			}
+		}
+
+		std::uint64_t bucket = due >> LevelShift(level);
+		if (level == LevelCount - 1) {
+			// Beyond the wheel's horizon, park it in the farthest slot, it gets re-sorted on cascade
+			bucket = std::min(bucket, (this->currentTick >> LevelShift(level)) + SlotMask);
+		}
+
+		const std::uint32_t slot = static_cast<std::uint32_t>(bucket & SlotMask);
+		std::uint32_t& head = this->slots[level][slot];
+
+		node.level = static_cast<std::uint8_t>(level);
+		node.slot = static_cast<std::uint8_t>(slot);
+		node.prev = npos;
+		node.next = head;
+		if (head != npos) {
+			this->nodes[head].prev = a_index;
+		}
+		head = a_index;
+	}
+
+	void TimingWheel::Unlink(std::uint32_t a_index) {
+		Node& node = this->nodes[a_index];
+		if (node.prev != npos) {
+			this->nodes[node.prev].next = node.next;
+		} else {
+			this->slots[node.level][node.slot] = node.next;
+		}
+		if (node.next != npos) {
+			this->nodes[node.next].prev = node.prev;
+		}
+		node.prev = npos;
+		node.next = npos;
+	}
+
+	void TimingWheel::Cascade(std::uint32_t a_level) {
+		const std::uint32_t slot = static_cast<std::uint32_t>((this->currentTick >> LevelShift(a_level)) & SlotMask);
+		std::uint32_t index = this->slots[a_level][slot];
+		this->slots[a_level][slot] = npos;
+		while (index != npos) {
+			std::uint32_t next = this->nodes[index].next;
+			this->Insert(index);
+			index = next;
+		}
+	}
+
+	void TimingWheel::FireSlot(std::uint32_t a_slot) {
+		std::uint32_t index = this->slots[0][a_slot];
+		if (index == npos) {
+			return;
+		}
+		this->slots[0][a_slot] = npos;
+
+		// Detach the whole slot first, callbacks are free to schedule or cancel anything
+		this->firing.clear();
+		while (index != npos) {
+			Node& node = this->nodes[index];
+			node.level = kFiring;
+			this->firing.emplace_back(index, node.generation);
+			index = node.next;
+			node.prev = npos;
+			node.next = npos;
+		}
+
+		for (std::size_t i = 0; i < this->firing.size(); i++) {
+			auto [fireIndex, generation] = this->firing[i];
+			if (this->nodes[fireIndex].generation != generation) {
+				continue; // Cancelled by an earlier callback
+			}
+
+			// Ticks are coarser than the requested delay, never fire early
+			if (this->nodes[fireIndex].due > this->now) {
+				this->Insert(fireIndex);
+				continue;
+			}
+
+			Callback callback = std::move(this->nodes[fireIndex].callback);
+			bool keep = callback();
+
+			// The callback may have grown the node pool or cancelled itself
+			Node& node = this->nodes[fireIndex];
+			if (node.generation != generation) {
+				continue;
+			}
+			if (keep && node.interval > 0.0) {
+				node.callback = std::move(callback);
+				node.due = this->now + node.interval;
+				node.deadline = ToTicks(node.due);
+				this->Insert(fireIndex);
+			} else {
+				this->Release(fireIndex);
+			}
+		}
+		this->firing.clear();
+	}
+
+	std::uint64_t TimingWheel::ToTicks(double a_seconds) const {
+		return static_cast<std::uint64_t>(std::max(a_seconds, 0.0) / TickSeconds);
+	}
+
+	TimingWheel::Node* TimingWheel::Resolve(TimerID a_handle) {
+		return const_cast<Node*>(std::as_const(*this).Resolve(a_handle));
+	}
+
+	const TimingWheel::Node* TimingWheel::Resolve(TimerID a_handle) const {
+		if (a_handle == 0) {
+			return nullptr;
+		}
+		const std::uint64_t index = (a_handle & 0xFFFFFFFF) - 1;
+		const std::uint32_t generation = static_cast<std::uint32_t>(a_handle >> 32);
+		if (index >= this->nodes.size()) {
+			return nullptr;
+		}
+		const Node& node = this->nodes[index];
+		if (node.level == kFree || node.generation != generation) {
+			return nullptr;
+		}
+		return &node;
+	}
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+// Hierarchical Timing Wheel
+//
+// Holds delayed one-shots, repeating timers and timeouts.
+// Scheduling and cancelling are O(1), timers are only touched when their slot comes due
+// so pending timers cost nothing while they wait.
+
+namespace GTS {
+
+	// Opaque handle to a scheduled timer, 0 is never a valid handle
+	using TimerID = std::uint64_t;
+
+	class TimingWheel {
+		public:
+			// Return true to keep a repeating timer alive, one-shots ignore the result
+			using Callback = std::function<bool()>;
+
+			static constexpr double TickSeconds = 1.0 / 64.0;
+			static constexpr std::uint32_t SlotBits = 6;
+			static constexpr std::uint32_t SlotCount = 1u << SlotBits;
+			static constexpr std::uint32_t LevelCount = 4;
+
+			explicit TimingWheel(double a_now = 0.0);
+
+			TimerID After(double a_delay, Callback a_callback);
+			TimerID Every(double a_interval, Callback a_callback);
+			bool Cancel(TimerID a_handle);
+			bool IsPending(TimerID a_handle) const;
+
+			// Fires everything that came due up to a_now
+			void Advance(double a_now);
+			void Clear();
+
+			std::size_t Pending() const;
+
+		private:
+			static constexpr std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+			static constexpr std::uint8_t kFree = 0xFF;
+			static constexpr std::uint8_t kFiring = 0xFE;
+
+			struct Node {
+				Callback callback = nullptr;
+				double due = 0.0;
+				double interval = 0.0;
+				std::uint64_t deadline = 0;
+				std::uint32_t prev = npos;
+				std::uint32_t next = npos;
+				std::uint32_t generation = 1;
+				std::uint8_t level = kFree;
+				std::uint8_t slot = 0;
+			};
+
+			TimerID Schedule(double a_delay, double a_interval, Callback a_callback);
+			std::uint32_t Allocate();
+			void Release(std::uint32_t a_index);
+			void Insert(std::uint32_t a_index);
+			void Unlink(std::uint32_t a_index);
+			void Cascade(std::uint32_t a_level);
+			void FireSlot(std::uint32_t a_slot);
+			std::uint64_t ToTicks(double a_seconds) const;
+			Node* Resolve(TimerID a_handle);
+			const Node* Resolve(TimerID a_handle) const;
+
+			std::vector<Node> nodes;
+			std::vector<std::uint32_t> freeList;
+			std::vector<std::pair<std::uint32_t, std::uint32_t>> firing;
+			std::array<std::array<std::uint32_t, SlotCount>, LevelCount> slots;
+			std::uint64_t currentTick = 0;
+			double now = 0.0;
+			std::size_t pending = 0;
+	};
+}
@@ -2,8 +2,11 @@
 
 #include "Utils/Node.hpp"
 #include "Utils/Timer.hpp"
+#include "Utils/TimingWheel.hpp"
+#include "Utils/TimerManager.hpp"
 #include "Utils/ActorUtils.hpp"
 #include "Utils/ActorBools.hpp"
+#include "Utils/ActorFacts.hpp"
 #include "Utils/AV.hpp"
 #include "Utils/Camera.hpp"
 #include "Utils/Debug.hpp"
@@ -12,6 +15,7 @@
 #include "Utils/Smooth.hpp"
 #include "Utils/Spring.hpp"
 #include "Utils/Text.hpp"
+#include "Utils/TagClassifier.hpp"
 #include "Utils/Units.hpp"
 #include "Utils/DInput.hpp"
 #include "Utils/Fmt.hpp"
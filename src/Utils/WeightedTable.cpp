@@ -0,0 +1,62 @@
+#include "Utils/WeightedTable.hpp"
+
+namespace GTS {
+
+	WeightedTable::WeightedTable(std::initializer_list<int> a_weights) :
+		WeightedTable(std::span<const int>(a_weights.begin(), a_weights.size())) {
+	}
+
+	WeightedTable::WeightedTable(std::span<const int> a_weights) {
+		const std::size_t count = std::max<std::size_t>(a_weights.size(), 1);
+		this->probability.assign(count, 1.0f);
+		this->alias.resize(count);
+		std::iota(this->alias.begin(), this->alias.end(), 0u);
+
+		double total = 0.0;
+		for (int weight : a_weights) {
+			total += std::max(weight, 0);
+		}
+		if (total <= 0.0) {
+			// Matches RandomIntWeighted, everything goes to 0
+			std::ranges::fill(this->alias, 0u);
+			std::ranges::fill(this->probability, 0.0f);
+			this->probability[0] = 1.0f;
+			return;
+		}
+
+		// Vose's alias method
+		std::vector<double> scaled(count);
+		std::vector<std::uint32_t> small;
+		std::vector<std::uint32_t> large;
+		for (std::size_t i = 0; i < count; i++) {
+			scaled[i] = std::max(a_weights[i], 0) * static_cast<double>(count) / total;
+			(scaled[i] < 1.0 ? small : large).push_back(static_cast<std::uint32_t>(i));
+		}
+		while (!small.empty() && !large.empty()) {
+			const std::uint32_t less = small.back();
+			small.pop_back();
+			const std::uint32_t more = large.back();
+
+			this->probability[less] = static_cast<float>(scaled[less]);
+			this->alias[less] = more;
+
+			scaled[more] = (scaled[more] + scaled[less]) - 1.0;
+			if (scaled[more] < 1.0) {
+				large.pop_back();
+				small.push_back(more);
+			}
+		}
+		// Whatever is left is 1 up to rounding
+		for (auto index : large) {
+			this->probability[index] = 1.0f;
+		}
+		for (auto index : small) {
+			this->probability[index] = 1.0f;
+		}
+	}
+
+	int WeightedTable::Pick(Xoshiro256& a_generator) const {
+		const auto index = static_cast<std::size_t>(a_generator.Below(this->probability.size()));
+		return a_generator.Unit() < this->probability[index] ? static_cast<int>(index) : static_cast<int>(this->alias[index]);
+	}
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include "Utils/Xoshiro256.hpp"
+
+namespace GTS {
+
+	// Precomputed alias table for weights that never change, each pick is O(1) no matter how many entries
+	class WeightedTable {
+		public:
+			WeightedTable(std::initializer_list<int> a_weights);
+			explicit WeightedTable(std::span<const int> a_weights);
+
+			// Draws from this thread's generator, defined in Random.hpp
+			[[nodiscard]] int Pick() const;
+			[[nodiscard]] int Pick(Xoshiro256& a_generator) const;
+			[[nodiscard]] std::size_t Size() const {
+				return this->probability.size();
+			}
+
+		private:
+			std::vector<float> probability;
+			std::vector<std::uint32_t> alias;
+	};
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+// xoshiro256** generator, satisfies UniformRandomBitGenerator so std distributions accept it
+
+namespace GTS {
+
+	class Xoshiro256 {
+		public:
+			using result_type = std::uint64_t;
+
+			explicit Xoshiro256(std::uint64_t a_seed = 0) noexcept {
+				this->Seed(a_seed);
+			}
+
+			void Seed(std::uint64_t a_seed) noexcept {
+				// splitmix64 so similar seeds still give unrelated states
+				for (auto& word : this->state) {
+					a_seed += 0x9E3779B97F4A7C15ull;
+					std::uint64_t z = a_seed;
+					z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+					z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+					word = z ^ (z >> 31);
+				}
+			}
+
+			static constexpr result_type min() noexcept {
+				return 0;
+			}
+
+			static constexpr result_type max() noexcept {
+				return std::numeric_limits<result_type>::max();
+			}
+
+			result_type operator()() noexcept {
+				const std::uint64_t result = std::rotl(this->state[1] * 5, 7) * 9;
+				const std::uint64_t t = this->state[1] << 17;
+				this->state[2] ^= this->state[0];
+				this->state[3] ^= this->state[1];
+				this->state[1] ^= this->state[2];
+				this->state[0] ^= this->state[3];
+				this->state[2] ^= t;
+				this->state[3] = std::rotl(this->state[3], 45);
+				return result;
+			}
+
+			// [0, 1)
+			double Unit() noexcept {
+				return static_cast<double>((*this)() >> 11) * 0x1.0p-53;
+			}
+
+			// [0, a_bound), a_bound <= 2^32
+			std::uint64_t Below(std::uint64_t a_bound) noexcept {
+				if (a_bound > std::numeric_limits<std::uint32_t>::max()) {
+					return (*this)() >> 32;
+				}
+				// Lemire's multiply and reject, no division on the common path
+				const auto bound = static_cast<std::uint32_t>(a_bound);
+				std::uint64_t product = ((*this)() >> 32) * bound;
+				auto low = static_cast<std::uint32_t>(product);
+				if (low < bound) {
+					const std::uint32_t threshold = (0u - bound) % bound;
+					while (low < threshold) {
+						product = ((*this)() >> 32) * bound;
+						low = static_cast<std::uint32_t>(product);
+					}
+				}
+				return product >> 32;
+			}
+
+		private:
+			std::array<std::uint64_t, 4> state = {};
+	};
+}
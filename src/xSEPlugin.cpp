@@ -12,8 +12,13 @@
 #include "Managers/Input/InputManager.hpp"
 #include "Managers/Animation/Utils/CooldownManager.hpp"
 #include "Managers/Console/ConsoleManager.hpp"
+#include "Managers/PapyrusScheduler.hpp"
+#include "Profiler/FrameBenchmark.hpp"
 
 #include "Utils/Logger.hpp"
+#include "Scale/SizeCache.hpp"
+#include "Scale/ScaleSnapshot.hpp"
+#include "Utils/InventoryTransfer.hpp"
 
 using namespace SKSE;
 using namespace RE;
@@ -105,11 +110,22 @@ namespace {
 	void InitializeEventSystem() {
 
 		EventDispatcher::AddListener(&DebugOverlayMenu::GetSingleton());
+		EventDispatcher::AddListener(&RandomService::GetSingleton()); // Reseeds random rolls on load, before anything rolls
 		EventDispatcher::AddListener(&Runtime::GetSingleton()); // Stores spells, globals and other important data
+		EventDispatcher::AddListener(&PerkCache::GetSingleton()); // Perk ownership bits, indexed after Runtime resolves the perks
 		EventDispatcher::AddListener(&Persistent::GetSingleton());
 		EventDispatcher::AddListener(&Transient::GetSingleton());
+		EventDispatcher::AddListener(&DataCompactor::GetSingleton());
+		EventDispatcher::AddListener(&SizeCache::GetSingleton());
+		EventDispatcher::AddListener(&ScaleSnapshot::GetSingleton()); // Scale values Papyrus tasklets can read
+		EventDispatcher::AddListener(&ActorFacts::GetSingleton());
 		EventDispatcher::AddListener(&CooldownManager::GetSingleton());
 		EventDispatcher::AddListener(&TaskManager::GetSingleton());
+		EventDispatcher::AddListener(&InventoryTransfer::GetSingleton()); // Finishes loot transfers that didn't fit in a frame
+		EventDispatcher::AddListener(&PapyrusScheduler::GetSingleton()); // Runs PapyrusUpdate at a fixed rate
+		EventDispatcher::AddListener(&FrameBenchmark::GetSingleton()); // benchframe/benchsuite console commands
+		EventDispatcher::AddListener(&TimerManager::GetSingleton());
+		EventDispatcher::AddListener(&FootTagClassifier::GetSingleton());
 		EventDispatcher::AddListener(&SpringManager::GetSingleton());
 
 		log::info("Added Default Listeners");
@@ -0,0 +1,43 @@
+#include "Utils/DeathGrouping.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace GTS;
+
+namespace {
+
+	struct Kill {
+		std::uint32_t giant = 0;
+		int cause = 0;
+	};
+}
+
+TEST(DeathGrouping, GroupInOrderGroupsByKeyInFirstSeenOrder) {
+	const std::vector<Kill> kills = {
+		{ 0x14, 1 }, { 0x20, 1 }, { 0x14, 2 }, { 0x14, 1 }, { 0x20, 1 }, { 0x14, 1 },
+	};
+	const auto groups = GroupInOrder(std::span<const Kill>(kills), [](const Kill& kill) {
+		return std::make_pair(kill.giant, kill.cause);
+	});
+
+	ASSERT_EQ(groups.size(), 3u);
+	EXPECT_EQ(groups[0], (std::vector<std::size_t>{ 0, 3, 5 }));
+	EXPECT_EQ(groups[1], (std::vector<std::size_t>{ 1, 4 }));
+	EXPECT_EQ(groups[2], (std::vector<std::size_t>{ 2 }));
+}
+
+TEST(DeathGrouping, GroupInOrderOfNothingIsNothing) {
+	const auto groups = GroupInOrder(std::span<const Kill>(), [](const Kill& kill) {
+		return kill.giant;
+	});
+	EXPECT_TRUE(groups.empty());
+}
+
+TEST(DeathGrouping, SummarizeVictimsCountsRepeatedNames) {
+	const std::vector<std::string_view> names = { "Bandit", "Bandit Marauder", "Bandit", "Wolf", "Bandit", "Bandit Marauder" };
+	EXPECT_EQ(SummarizeVictims(names), "Bandit x3, Bandit Marauder x2, Wolf");
+
+	const std::vector<std::string_view> single = { "Lydia" };
+	EXPECT_EQ(SummarizeVictims(single), "Lydia");
+	EXPECT_TRUE(SummarizeVictims({}).empty());
+}
@@ -0,0 +1,154 @@
+#include "Managers/FinisherTable.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace GTS;
+
+namespace {
+
+	struct TimeScope {
+		TimeScope() {
+			Time::Reset();
+		}
+		~TimeScope() {
+			Time::Reset();
+		}
+	};
+}
+
+TEST(FinisherTable, RunsAFinisherThroughItsStages) {
+	TimeScope time;
+	FinisherTable table;
+	Actor giant(0x14);
+	Actor tiny(0x100);
+
+	ASSERT_TRUE(table.Start(&giant, &tiny));
+	EXPECT_FALSE(table.Start(&giant, &tiny));
+	EXPECT_TRUE(table.Contains(tiny.formID));
+	EXPECT_EQ(table.RunningCount(), 1u);
+
+	std::vector<FinisherStage> stages;
+	auto step = [&stages](FinisherTable::Slot& slot, Actor*, Actor*) {
+		stages.push_back(slot.stage);
+		switch (stages.size()) {
+			case 1: return FinisherStep::Wait;
+			case 2: return FinisherStep::Next;
+			default: return FinisherStep::Done;
+		}
+	};
+	table.Advance(step);
+	table.Advance(step);
+	table.Advance(step);
+	table.Advance(step);
+
+	EXPECT_EQ(stages, (std::vector<FinisherStage>{ FinisherStage::Start, FinisherStage::Start, FinisherStage::Finishing }));
+	EXPECT_EQ(table.RunningCount(), 0u);
+	EXPECT_EQ(table.FinishedCount(), 1u);
+	// Finished tinies still count until they are reset
+	EXPECT_TRUE(table.Contains(tiny.formID));
+	EXPECT_FALSE(table.Start(&giant, &tiny));
+
+	table.Erase(tiny.formID);
+	EXPECT_FALSE(table.Contains(tiny.formID));
+	EXPECT_TRUE(table.Start(&giant, &tiny));
+}
+
+TEST(FinisherTable, DropsFinishersWhoseActorIsGone) {
+	TimeScope time;
+	FinisherTable table;
+	Actor giant(0x14);
+	auto tiny = std::make_unique<Actor>(0x100);
+	const FormID tinyId = tiny->formID;
+
+	ASSERT_TRUE(table.Start(&giant, tiny.get()));
+	tiny.reset();
+
+	int steps = 0;
+	table.Advance([&steps](FinisherTable::Slot&, Actor*, Actor*) {
+		steps += 1;
+		return FinisherStep::Done;
+	});
+	EXPECT_EQ(steps, 0);
+	EXPECT_EQ(table.RunningCount(), 0u);
+	EXPECT_FALSE(table.Contains(tinyId));
+}
+
+TEST(FinisherTable, ReusesSlotsAndIgnoresStaleQueueEntries) {
+	TimeScope time;
+	FinisherTable table;
+	Actor giant(0x14);
+	Actor first(0x100);
+	Actor second(0x101);
+
+	ASSERT_TRUE(table.Start(&giant, &first));
+	// Erasing leaves a queue entry behind that must not run for the next finisher in the slot
+	table.Erase(first.formID);
+	ASSERT_TRUE(table.Start(&giant, &second));
+
+	std::vector<FormID> stepped;
+	table.Advance([&stepped](FinisherTable::Slot& slot, Actor*, Actor* tiny) {
+		stepped.push_back(tiny->formID);
+		EXPECT_EQ(slot.tinyId, tiny->formID);
+		return FinisherStep::Wait;
+	});
+	EXPECT_EQ(stepped, (std::vector<FormID>{ second.formID }));
+	EXPECT_EQ(table.RunningCount(), 1u);
+}
+
+TEST(FinisherTable, StartsFinishersFromInsideAStepOnTheNextAdvance) {
+	TimeScope time;
+	FinisherTable table;
+	Actor giant(0x14);
+	std::vector<std::unique_ptr<Actor>> tinies;
+	for (FormID id = 0x100; id < 0x140; ++id) {
+		tinies.push_back(std::make_unique<Actor>(id));
+	}
+
+	ASSERT_TRUE(table.Start(&giant, tinies[0].get()));
+	std::size_t next = 1;
+	int steps = 0;
+	// Every step starts another finisher, growing the slot table while it is being walked
+	auto step = [&](FinisherTable::Slot&, Actor* a_giant, Actor*) {
+		steps += 1;
+		if (next < tinies.size()) {
+			table.Start(a_giant, tinies[next++].get());
+		}
+		return FinisherStep::Done;
+	};
+	table.Advance(step);
+	EXPECT_EQ(steps, 1);
+	EXPECT_EQ(table.RunningCount(), 1u);
+
+	while (table.RunningCount() > 0) {
+		table.Advance(step);
+	}
+	EXPECT_EQ(steps, static_cast<int>(tinies.size()));
+	EXPECT_EQ(table.FinishedCount(), tinies.size());
+}
+
+TEST(FinisherTable, PrunesFinishedTiniesOnceTheirReferenceIsDeleted) {
+	TimeScope time;
+	FinisherTable table;
+	Actor giant(0x14);
+	Actor kept(0x100);
+	auto deleted = std::make_unique<Actor>(0x101);
+	const FormID deletedId = deleted->formID;
+
+	ASSERT_TRUE(table.Start(&giant, &kept));
+	ASSERT_TRUE(table.Start(&giant, deleted.get()));
+	table.Advance([](FinisherTable::Slot&, Actor*, Actor*) {
+		return FinisherStep::Done;
+	});
+	ASSERT_EQ(table.FinishedCount(), 2u);
+
+	deleted.reset();
+	// Pruning is throttled to once every few seconds
+	table.PruneFinished();
+	for (int frame = 0; frame < 600 && table.FinishedCount() > 1; ++frame) {
+		Time::Step(1.0 / 60.0);
+		table.PruneFinished();
+	}
+	EXPECT_EQ(table.FinishedCount(), 1u);
+	EXPECT_TRUE(table.Contains(kept.formID));
+	EXPECT_FALSE(table.Contains(deletedId));
+}
@@ -0,0 +1,75 @@
+#include "Utils/LockFreeQueue.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace GTS;
+
+TEST(LockFreeQueue, KeepsFIFOOrderAndReportsFullAndEmpty) {
+	LockFreeQueue<int, 4> queue;
+	int value = 0;
+	EXPECT_FALSE(queue.TryPop(value));
+
+	for (int i = 0; i < 4; ++i) {
+		ASSERT_TRUE(queue.TryPush(i));
+	}
+	EXPECT_FALSE(queue.TryPush(4));
+
+	for (int i = 0; i < 4; ++i) {
+		ASSERT_TRUE(queue.TryPop(value));
+		EXPECT_EQ(value, i);
+	}
+	EXPECT_FALSE(queue.TryPop(value));
+}
+
+TEST(LockFreeQueue, WrapsAroundItsCapacity) {
+	LockFreeQueue<int, 2> queue;
+	int value = 0;
+	for (int i = 0; i < 100; ++i) {
+		ASSERT_TRUE(queue.TryPush(i));
+		ASSERT_TRUE(queue.TryPop(value));
+		EXPECT_EQ(value, i);
+	}
+}
+
+TEST(LockFreeQueue, DeliversEveryItemOnceWithSeveralProducersAndConsumers) {
+	constexpr int Producers = 4;
+	constexpr int Consumers = 2;
+	constexpr int PerProducer = 20000;
+
+	LockFreeQueue<std::uint32_t, 1024> queue;
+	std::vector<std::atomic<int>> seen(Producers * PerProducer);
+	std::atomic<int> popped = 0;
+
+	std::vector<std::thread> threads;
+	for (int p = 0; p < Producers; ++p) {
+		threads.emplace_back([&queue, p]() {
+			for (int i = 0; i < PerProducer; ++i) {
+				const auto item = static_cast<std::uint32_t>(p * PerProducer + i);
+				while (!queue.TryPush(item)) {
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+	for (int c = 0; c < Consumers; ++c) {
+		threads.emplace_back([&]() {
+			std::uint32_t item = 0;
+			while (popped.load() < Producers * PerProducer) {
+				if (queue.TryPop(item)) {
+					seen[item].fetch_add(1);
+					popped.fetch_add(1);
+				} else {
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	EXPECT_EQ(popped.load(), Producers * PerProducer);
+	EXPECT_TRUE(std::ranges::all_of(seen, [](const std::atomic<int>& count) {
+		return count.load() == 1;
+	}));
+}
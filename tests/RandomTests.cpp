@@ -0,0 +1,76 @@
+#include "Utils/WeightedTable.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace GTS;
+
+TEST(Random, Xoshiro256IsDeterministicPerSeed) {
+	Xoshiro256 a(1234);
+	Xoshiro256 b(1234);
+	Xoshiro256 c(1235);
+
+	bool differs = false;
+	for (int i = 0; i < 64; ++i) {
+		const auto value = a();
+		EXPECT_EQ(value, b());
+		differs |= value != c();
+	}
+	EXPECT_TRUE(differs);
+
+	a.Seed(99);
+	b.Seed(99);
+	EXPECT_EQ(a(), b());
+}
+
+TEST(Random, Xoshiro256UnitAndBelowStayInRange) {
+	Xoshiro256 generator(42);
+	std::array<int, 7> buckets = {};
+	for (int i = 0; i < 70000; ++i) {
+		const double unit = generator.Unit();
+		ASSERT_GE(unit, 0.0);
+		ASSERT_LT(unit, 1.0);
+
+		const auto below = generator.Below(7);
+		ASSERT_LT(below, 7u);
+		buckets[below] += 1;
+	}
+	// Roughly uniform, 10000 expected per bucket
+	for (int count : buckets) {
+		EXPECT_GT(count, 9000);
+		EXPECT_LT(count, 11000);
+	}
+	EXPECT_EQ(generator.Below(1), 0u);
+}
+
+TEST(Random, WeightedTablePicksInProportionToTheWeights) {
+	const WeightedTable table = { 10, 0, 30, 60 };
+	ASSERT_EQ(table.Size(), 4u);
+
+	Xoshiro256 generator(7);
+	std::array<int, 4> picks = {};
+	constexpr int Draws = 100000;
+	for (int i = 0; i < Draws; ++i) {
+		const int pick = table.Pick(generator);
+		ASSERT_GE(pick, 0);
+		ASSERT_LT(pick, 4);
+		picks[pick] += 1;
+	}
+
+	EXPECT_EQ(picks[1], 0);
+	EXPECT_LT(std::abs(picks[0] - Draws * 0.1), Draws * 0.01);
+	EXPECT_LT(std::abs(picks[2] - Draws * 0.3), Draws * 0.01);
+	EXPECT_LT(std::abs(picks[3] - Draws * 0.6), Draws * 0.01);
+}
+
+TEST(Random, WeightedTableSendsEverythingTo0WhenNoWeightIsPositive) {
+	Xoshiro256 generator(3);
+
+	const WeightedTable zeros = { 0, 0, 0 };
+	const WeightedTable negative = { -5, -1 };
+	const WeightedTable empty { std::span<const int>() };
+	for (int i = 0; i < 1000; ++i) {
+		ASSERT_EQ(zeros.Pick(generator), 0);
+		ASSERT_EQ(negative.Pick(generator), 0);
+		ASSERT_EQ(empty.Pick(generator), 0);
+	}
+}
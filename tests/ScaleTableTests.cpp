@@ -0,0 +1,145 @@
+#include "Scale/ScaleTable.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace GTS;
+
+namespace {
+
+	ScaleValues Stored(FormID id) {
+		const float base = static_cast<float>(id);
+		return ScaleValues { .target = base, .max = base * 2.0f, .visual = base * 3.0f, .giantess = base * 4.0f };
+	}
+
+	// What ScaleSnapshot answers off the main thread: nothing yet, ask for the actor next frame
+	ScaleTable::MissFunction RequestingMiss(ScaleTable& table, std::vector<FormID>& misses) {
+		return [&table, &misses](FormID id) {
+			misses.push_back(id);
+			table.Request(id);
+			return ScaleValues {};
+		};
+	}
+
+	// What ScaleSnapshot answers on the main thread: the live values
+	ScaleValues LiveMiss(FormID id) {
+		return ScaleValues { .target = -static_cast<float>(id) };
+	}
+
+	void Fill(ScaleTable& table, std::initializer_list<FormID> ids) {
+		std::vector<std::pair<FormID, ScaleValues>> values;
+		for (FormID id : ids) {
+			values.emplace_back(id, Stored(id));
+		}
+		table.Store(values);
+	}
+}
+
+TEST(ScaleTable, BulkMatchesSingleForHitsMissesAndNoActor) {
+	ScaleTable table;
+	Fill(table, { 0x14, 0x100, 0x200 });
+	const std::vector<FormID> ids = { 0x14, 0x300, 0, 0x200, 0x14, 0x400, 0x100 };
+
+	const auto bulk = table.GetMany(ids, LiveMiss);
+	ASSERT_EQ(bulk.size(), ids.size());
+	for (std::size_t i = 0; i < ids.size(); i++) {
+		EXPECT_EQ(bulk[i], table.Get(ids[i], LiveMiss)) << "id " << ids[i];
+	}
+
+	EXPECT_EQ(bulk[0], Stored(0x14));
+	EXPECT_EQ(bulk[1], LiveMiss(0x300));
+	EXPECT_EQ(bulk[2], ScaleValues {});
+	EXPECT_EQ(bulk[6], Stored(0x100));
+}
+
+TEST(ScaleTable, BulkMatchesSingleWhenMissesAreRequested) {
+	ScaleTable table;
+	Fill(table, { 0x14 });
+	std::vector<FormID> misses;
+	const auto miss = RequestingMiss(table, misses);
+	const std::vector<FormID> ids = { 0x20, 0x14, 0x20, 0 };
+
+	const auto bulk = table.GetMany(ids, miss);
+	EXPECT_EQ(misses, (std::vector<FormID>{ 0x20, 0x20 }));
+	for (std::size_t i = 0; i < ids.size(); i++) {
+		EXPECT_EQ(bulk[i], table.Get(ids[i], miss)) << "id " << ids[i];
+	}
+
+	// Asked for three times, queued once
+	EXPECT_EQ(table.TakeRequests(), (std::vector<FormID>{ 0x20 }));
+	EXPECT_TRUE(table.TakeRequests().empty());
+}
+
+TEST(ScaleTable, NoActorNeverReachesTheMissFunction) {
+	ScaleTable table;
+	std::vector<FormID> misses;
+	const auto miss = RequestingMiss(table, misses);
+
+	EXPECT_EQ(table.Get(0, miss), ScaleValues {});
+	const std::vector<FormID> ids = { 0, 0 };
+	EXPECT_EQ(table.GetMany(ids, miss), (std::vector<ScaleValues>(2)));
+	EXPECT_TRUE(misses.empty());
+}
+
+TEST(ScaleTable, StoreOverwritesAndEraseForgets) {
+	ScaleTable table;
+	Fill(table, { 0x14, 0x20, 0x30 });
+	const std::pair<FormID, ScaleValues> grown { 0x14, ScaleValues { .target = 9.0f } };
+	table.Store(std::span(&grown, 1));
+	EXPECT_EQ(table.Get(0x14, LiveMiss).target, 9.0f);
+
+	table.Erase(0x20);
+	EXPECT_EQ(table.Get(0x20, LiveMiss), LiveMiss(0x20));
+
+	table.EraseIf([](FormID id) {
+		return id == 0x30;
+	});
+	EXPECT_EQ(table.Size(), 1u);
+
+	table.Request(0x40);
+	table.Clear();
+	EXPECT_EQ(table.Size(), 0u);
+	EXPECT_TRUE(table.TakeRequests().empty());
+}
+
+TEST(ScaleTable, BulkReadsSeeWholeEntriesWhileTheMainThreadStores) {
+	constexpr FormID Actors = 64;
+	constexpr int Frames = 500;
+
+	ScaleTable table;
+	std::atomic<bool> done = false;
+	std::atomic<int> torn = 0;
+
+	std::vector<FormID> ids;
+	for (FormID id = 1; id <= Actors; id++) {
+		ids.push_back(id);
+	}
+
+	std::vector<std::thread> readers;
+	for (int i = 0; i < 3; i++) {
+		readers.emplace_back([&]() {
+			while (!done.load()) {
+				for (const auto& values : table.GetMany(ids, LiveMiss)) {
+					// A stored entry always has every field equal, a miss has a negative target
+					if (values.target >= 0.0f && (values.max != values.target || values.visual != values.target || values.giantess != values.target)) {
+						torn++;
+					}
+				}
+			}
+		});
+	}
+
+	for (int frame = 0; frame < Frames; frame++) {
+		std::vector<std::pair<FormID, ScaleValues>> fresh;
+		for (FormID id : ids) {
+			const float scale = static_cast<float>(frame);
+			fresh.emplace_back(id, ScaleValues { .target = scale, .max = scale, .visual = scale, .giantess = scale });
+		}
+		table.Store(fresh);
+	}
+	done = true;
+	for (auto& reader : readers) {
+		reader.join();
+	}
+
+	EXPECT_EQ(torn.load(), 0);
+}
@@ -0,0 +1,47 @@
+#include "Stubs/GameStubs.hpp"
+
+namespace {
+
+	std::unordered_map<std::uint32_t, RE::Actor*> Handles;
+	std::uint32_t NextHandle = 1;
+
+	double WorldTime = 0.0;
+	std::uint64_t Frames = 0;
+}
+
+namespace RE {
+
+	ActorPointer ActorHandle::get() const {
+		auto found = Handles.find(this->id);
+		return ActorPointer(found != Handles.end() ? found->second : nullptr);
+	}
+
+	Actor::Actor(FormID a_formID) : formID(a_formID), handle(NextHandle++) {
+		Handles.emplace(this->handle, this);
+	}
+
+	Actor::~Actor() {
+		Handles.erase(this->handle);
+	}
+}
+
+namespace GTS {
+
+	double Time::WorldTimeElapsed() {
+		return WorldTime;
+	}
+
+	std::uint64_t Time::FramesElapsed() {
+		return Frames;
+	}
+
+	void Time::Step(double a_seconds) {
+		WorldTime += a_seconds;
+		Frames += 1;
+	}
+
+	void Time::Reset() {
+		WorldTime = 0.0;
+		Frames = 0;
+	}
+}
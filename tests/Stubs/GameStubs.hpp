@@ -0,0 +1,82 @@
+#pragma once
+
+// The few CommonLib and plugin types the tested sources use, nothing more
+
+namespace RE {
+
+	using FormID = std::uint32_t;
+
+	class Actor;
+
+	// Resolves like NiPointer, falsy once the reference is gone
+	class ActorPointer {
+		public:
+			explicit ActorPointer(Actor* a_actor = nullptr) : actor(a_actor) {}
+
+			Actor* get() const {
+				return this->actor;
+			}
+			explicit operator bool() const {
+				return this->actor != nullptr;
+			}
+
+		private:
+			Actor* actor = nullptr;
+	};
+
+	class ActorHandle {
+		public:
+			ActorHandle() = default;
+			explicit ActorHandle(std::uint32_t a_id) : id(a_id) {}
+
+			ActorPointer get() const;
+			explicit operator bool() const {
+				return static_cast<bool>(this->get());
+			}
+
+		private:
+			std::uint32_t id = 0;
+	};
+
+	// Handles to it resolve until it is destroyed, like a reference that gets deleted
+	class Actor {
+		public:
+			explicit Actor(FormID a_formID);
+			~Actor();
+
+			Actor(const Actor&) = delete;
+			Actor& operator=(const Actor&) = delete;
+
+			ActorHandle CreateRefHandle() const {
+				return ActorHandle(this->handle);
+			}
+
+			FormID formID = 0;
+
+		private:
+			std::uint32_t handle = 0;
+	};
+}
+
+namespace SKSE::log {
+
+	template <class... Args>
+	void warn(std::string_view, Args&&...) {}
+
+	template <class... Args>
+	void info(std::string_view, Args&&...) {}
+}
+
+namespace GTS {
+
+	// World time and frame count, moved by the tests instead of the game
+	class Time {
+		public:
+			static double WorldTimeElapsed();
+			static std::uint64_t FramesElapsed();
+
+			// Advances the clock by a_seconds over one frame
+			static void Step(double a_seconds);
+			static void Reset();
+	};
+}
@@ -0,0 +1,71 @@
+#include "Utils/TagPattern.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace GTS;
+
+namespace {
+
+	// Every answer has to agree with std::regex_match
+	void CheckAgainstRegex(std::string_view a_pattern, std::initializer_list<std::string_view> a_inputs) {
+		const TagPattern pattern(a_pattern);
+		const std::regex regex{ std::string(a_pattern) };
+		for (const auto input : a_inputs) {
+			EXPECT_EQ(pattern.Matches(input), std::regex_match(input.begin(), input.end(), regex)) << "Pattern " << a_pattern << ", input " << input;
+		}
+	}
+}
+
+TEST(TagPattern, CompilesTheSupportedSubset) {
+	EXPECT_TRUE(TagPattern(".*Foot.*Left.*").IsCompiled());
+	EXPECT_TRUE(TagPattern(".*Jump.*(Down|Land).*").IsCompiled());
+	EXPECT_TRUE(TagPattern("NPC L Foot \\[Lft \\]").IsCompiled());
+	EXPECT_TRUE(TagPattern("FootLeft").IsCompiled());
+
+	// Character classes and quantifiers other than .* go to std::regex
+	EXPECT_FALSE(TagPattern("Foot\\d").IsCompiled());
+	EXPECT_FALSE(TagPattern("Foot[LR]").IsCompiled());
+	EXPECT_FALSE(TagPattern("Fo+t").IsCompiled());
+}
+
+TEST(TagPattern, MatchesTheWholeStringLikeStdRegexMatch) {
+	const std::initializer_list<std::string_view> tags = {
+		"", "Foot", "FootLeft", "FootRight", "FootSprintLeft", "FootScuffRight", "LeftFoot",
+		"JumpDown", "JumpLand", "JumpUp", "JumpFall", "SoundPlay.NPCHumanCombatIdle", "FootLeftFootLeft",
+	};
+
+	CheckAgainstRegex(".*Foot.*Left.*", tags);
+	CheckAgainstRegex(".*Foot.*Right.*", tags);
+	CheckAgainstRegex(".*Sprint.*", tags);
+	CheckAgainstRegex(".*Jump.*(Down|Land).*", tags);
+	CheckAgainstRegex("FootLeft", tags);
+	CheckAgainstRegex("Foot.*", tags);
+	CheckAgainstRegex(".*Left", tags);
+	CheckAgainstRegex("Foot.*Left", tags);
+}
+
+TEST(TagPattern, HandlesEscapesAndBacktracking) {
+	CheckAgainstRegex("NPC L Foot \\[Lft \\]", { "NPC L Foot [Lft ]", "NPC L Foot [Lft ", "NPC R Foot [Rft ]" });
+	// The first "ab" is not the one that lets the rest match
+	CheckAgainstRegex(".*ab.*abc", { "ababc", "abxabc", "abab", "abcabc" });
+	CheckAgainstRegex("(a|ab)c", { "ac", "abc", "abbc", "c" });
+}
+
+TEST(TagPattern, FallsBackToStdRegexOutsideTheSubset) {
+	const TagPattern pattern("Foot[LR].*");
+	ASSERT_FALSE(pattern.IsCompiled());
+	EXPECT_TRUE(pattern.Matches("FootLeft"));
+	EXPECT_TRUE(pattern.Matches("FootRight"));
+	EXPECT_FALSE(pattern.Matches("FootFront"));
+
+	// Invalid patterns never match and don't throw
+	const TagPattern invalid("Foot[");
+	EXPECT_FALSE(invalid.Matches("Foot["));
+}
+
+TEST(TagPattern, GetTagPatternCompilesEachPatternOnce) {
+	const TagPattern& first = GetTagPattern(".*Foot.*");
+	const TagPattern& second = GetTagPattern(std::string(".*Foot.*"));
+	EXPECT_EQ(&first, &second);
+	EXPECT_TRUE(first.Matches("NPC L Foot [Lft ]"));
+}
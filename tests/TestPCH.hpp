@@ -0,0 +1,42 @@
+#pragma once
+
+// Stands in for src/PCH.hpp when the game independent sources are built for the tests
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <ranges>
+#include <regex>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Stubs/GameStubs.hpp"
+
+namespace GTS {
+	using namespace std;
+	using namespace SKSE;
+	using namespace RE;
+}
+
+#include "Utils/Timer.hpp"
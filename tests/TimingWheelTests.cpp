@@ -0,0 +1,127 @@
+#include "Utils/TimingWheel.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace GTS;
+
+TEST(TimingWheel, FiresAOneShotOnceItComesDue) {
+	TimingWheel wheel(0.0);
+	int fired = 0;
+	const TimerID handle = wheel.After(1.0, [&fired]() {
+		fired += 1;
+		return true; // Ignored for one-shots
+	});
+
+	ASSERT_TRUE(handle != 0);
+	ASSERT_TRUE(wheel.IsPending(handle));
+
+	wheel.Advance(0.5);
+	EXPECT_EQ(fired, 0);
+
+	wheel.Advance(1.1);
+	EXPECT_EQ(fired, 1);
+	EXPECT_FALSE(wheel.IsPending(handle));
+
+	wheel.Advance(5.0);
+	EXPECT_EQ(fired, 1);
+	EXPECT_EQ(wheel.Pending(), 0u);
+}
+
+TEST(TimingWheel, FiresTimersInDeadlineOrderAcrossLevels) {
+	TimingWheel wheel(0.0);
+	std::vector<int> order;
+	// Spread over the first three levels of the wheel
+	const std::array<double, 5> delays = { 300.0, 0.1, 70.0, 2.0, 0.9 };
+	for (std::size_t i = 0; i < delays.size(); ++i) {
+		wheel.After(delays[i], [&order, i]() {
+			order.push_back(static_cast<int>(i));
+			return false;
+		});
+	}
+
+	for (double now = 0.0; now <= 400.0; now += 1.0 / 60.0) {
+		wheel.Advance(now);
+	}
+	EXPECT_EQ(order, (std::vector<int>{ 1, 4, 3, 2, 0 }));
+}
+
+TEST(TimingWheel, CancelStopsATimerAndInvalidatesItsHandle) {
+	TimingWheel wheel(0.0);
+	int fired = 0;
+	const TimerID handle = wheel.After(1.0, [&fired]() {
+		fired += 1;
+		return false;
+	});
+
+	EXPECT_TRUE(wheel.Cancel(handle));
+	EXPECT_FALSE(wheel.Cancel(handle));
+	EXPECT_FALSE(wheel.IsPending(handle));
+
+	// The freed node is reused, the old handle must not reach the new timer
+	const TimerID reused = wheel.After(1.0, []() {
+		return false;
+	});
+	EXPECT_TRUE(reused != handle);
+	EXPECT_FALSE(wheel.Cancel(handle));
+	EXPECT_TRUE(wheel.IsPending(reused));
+
+	wheel.Advance(2.0);
+	EXPECT_EQ(fired, 0);
+}
+
+TEST(TimingWheel, RepeatsATimerWhileItsCallbackReturnsTrue) {
+	TimingWheel wheel(0.0);
+	int fired = 0;
+	const TimerID handle = wheel.Every(0.5, [&fired]() {
+		fired += 1;
+		return fired < 3;
+	});
+
+	for (double now = 0.0; now <= 5.0; now += 0.25) {
+		wheel.Advance(now);
+	}
+	EXPECT_EQ(fired, 3);
+	EXPECT_FALSE(wheel.IsPending(handle));
+}
+
+TEST(TimingWheel, CallbacksMayScheduleAndCancelOtherTimers) {
+	TimingWheel wheel(0.0);
+	int chained = 0;
+	TimerID victim = 0;
+
+	wheel.After(0.5, [&]() {
+		wheel.Cancel(victim);
+		wheel.After(0.5, [&chained]() {
+			chained += 1;
+			return false;
+		});
+		return false;
+	});
+	victim = wheel.After(0.75, []() {
+		ADD_FAILURE() << "Cancelled timer fired";
+		return false;
+	});
+
+	for (double now = 0.0; now <= 2.0; now += 1.0 / 60.0) {
+		wheel.Advance(now);
+	}
+	EXPECT_EQ(chained, 1);
+	EXPECT_EQ(wheel.Pending(), 0u);
+}
+
+TEST(TimingWheel, ClearDropsEverythingPending) {
+	TimingWheel wheel(0.0);
+	int fired = 0;
+	for (int i = 0; i < 100; ++i) {
+		wheel.After(i * 0.1, [&fired]() {
+			fired += 1;
+			return false;
+		});
+	}
+	ASSERT_EQ(wheel.Pending(), 100u);
+
+	wheel.Clear();
+	EXPECT_EQ(wheel.Pending(), 0u);
+	wheel.Advance(20.0);
+	EXPECT_EQ(fired, 0);
+}